@@ -39,7 +39,6 @@ status_t dnnl_concat_primitive_desc_create(
 
     const int ndims = src_mds[0].ndims;
     const dims_t &dims = src_mds[0].dims;
-    const data_type_t dt = src_mds[0].data_type;
     if (memory_desc_wrapper(src_mds[0]).has_runtime_dims_or_strides())
         return unimplemented;
 
@@ -53,7 +52,6 @@ status_t dnnl_concat_primitive_desc_create(
             if (d == concat_dim) continue;
             if (src_mds[i].dims[d] != dims[d]) return invalid_arguments;
         }
-        if (src_mds[i].data_type != dt) return invalid_arguments;
         concat_dim_sz += src_mds[i].dims[concat_dim];
     }
 
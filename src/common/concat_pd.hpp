@@ -82,6 +82,11 @@ struct concat_pd_t : public primitive_desc_t {
 
     int concat_dim() const { return concat_dim_; }
 
+    /* scale applied to the i-th input, 1.f if not specified by the user */
+    float src_scale(int index) const {
+        return attr()->scales_.get(DNNL_ARG_MULTIPLE_SRC + index).scales_[0];
+    }
+
     const memory_desc_t *src_image_md(int index = 0) const {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
@@ -106,8 +111,10 @@ protected:
      *            intermediate (force_dst_md) memory with some plain format.
      *
      * @warning The call may fail. */
-    status_t init(const memory_desc_t *force_dst_md = nullptr) {
-        bool ok = attr()->has_default_values();
+    status_t init(const memory_desc_t *force_dst_md = nullptr,
+            primitive_attr_t::skip_mask_t attr_mask
+            = primitive_attr_t::skip_mask_t::none) {
+        bool ok = attr()->has_default_values(attr_mask) && attr_scales_ok();
         if (force_dst_md == nullptr)
             ok = ok && set_default_params() == status::success;
         if (!ok) return status::unimplemented;
@@ -144,6 +151,19 @@ protected:
         return status::success;
     }
 
+    /* only common (mask = 0) and defined scales for the inputs are supported
+     * by the concat primitive */
+    bool attr_scales_ok() const {
+        for (const auto &s : attr()->scales_.scales_) {
+            if (s.second.has_default_values()) continue;
+            const int src_index = s.first - DNNL_ARG_MULTIPLE_SRC;
+            const bool ok = src_index >= 0 && src_index < n_
+                    && s.second.mask_ == 0 && s.second.defined();
+            if (!ok) return false;
+        }
+        return true;
+    }
+
     status_t set_default_params() {
         if (dst_md_.format_kind != format_kind::any) return status::success;
 
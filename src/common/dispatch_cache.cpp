@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "dispatch_cache.hpp"
+#include "c_types_map.hpp"
+#include "rw_mutex.hpp"
+
+namespace dnnl {
+namespace impl {
+
+dispatch_cache_t &dispatch_cache() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    static const int capacity
+            = getenv_int("DNNL_DISPATCH_CACHE_CAPACITY", 1024);
+#else
+    static const int capacity = 0;
+#endif
+    static dispatch_cache_t cache(capacity);
+    return cache;
+}
+
+// Undocumented API, for testing and profiling only
+status_t get_dispatch_cache_stats(int *size, dim_t *hits, dim_t *misses) {
+    auto &cache = dispatch_cache();
+    if (size) *size = cache.get_size();
+    if (hits) *hits = cache.get_hits();
+    if (misses) *misses = cache.get_misses();
+    return status::success;
+}
+
+status_t dispatch_cache_t::set_capacity(int capacity) {
+    utils::lock_write_t lock_w(rw_mutex());
+    capacity_ = (size_t)capacity;
+    // Check if number of entries exceeds the new capacity
+    if (cache_list_.size() > capacity_) {
+        // Evict excess entries
+        size_t n_excess_entries = cache_list_.size() - capacity_;
+        evict(n_excess_entries);
+    }
+    return status::success;
+}
+
+int dispatch_cache_t::get_capacity() const {
+    utils::lock_read_t lock_r(rw_mutex());
+    return (int)capacity_;
+}
+
+int dispatch_cache_t::get_size() const {
+    utils::lock_read_t lock_r(rw_mutex());
+    return (int)cache_list_.size();
+}
+
+int dispatch_cache_t::get(const key_t &key) {
+    // Moving the entry to the front of the list modifies the cache, hence
+    // the write lock
+    utils::lock_write_t lock_w(rw_mutex());
+    if (capacity_ == 0) return -1;
+
+    auto it = cache_mapper_.find(key);
+    if (it == cache_mapper_.end()) {
+        misses_++;
+        return -1;
+    }
+
+    hits_++;
+    cache_list_.splice(cache_list_.begin(), cache_list_, it->second);
+    return cache_list_.front().second;
+}
+
+void dispatch_cache_t::add(const key_t &key, int impl_idx) {
+    utils::lock_write_t lock_w(rw_mutex());
+    if (capacity_ == 0) return;
+
+    // Another thread might have added the same entry in the meantime
+    auto it = cache_mapper_.find(key);
+    if (it != cache_mapper_.end()) {
+        it->second->second = impl_idx;
+        return;
+    }
+
+    if (cache_list_.size() >= capacity_) {
+        // Evict the least recently used entry
+        evict(1);
+    }
+    // Place a new entry to cache_list_ and update cache_mapper_
+    cache_list_.emplace_front(key, impl_idx);
+    cache_mapper_.insert(std::make_pair(key, cache_list_.begin()));
+    assert(cache_list_.size() == cache_mapper_.size());
+}
+
+void dispatch_cache_t::evict(size_t n) {
+    for (size_t e = 0; e < n; e++) {
+        cache_mapper_.erase(cache_list_.back().first);
+        cache_list_.pop_back();
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_DISPATCH_CACHE_HPP
+#define COMMON_DISPATCH_CACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <unordered_map>
+
+#include "c_types_map.hpp"
+#include "oneapi/dnnl/dnnl.h"
+#include "primitive_hashing.hpp"
+#include "rw_mutex.hpp"
+#include "type_helpers.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// The dispatch cache remembers the position in the engine implementation
+// list of the first implementation that accepted a given set of primitive
+// descriptor creation arguments. All the implementations before that
+// position are known to return `unimplemented` for the same arguments, so
+// the primitive descriptor iterator starts right from the cached position.
+// A position equal to the list length means that no implementation is
+// available. The cache uses LRU replacement policy.
+struct dispatch_cache_t : public c_compatible {
+    using key_t = primitive_hashing::key_t;
+
+    dispatch_cache_t(int capacity) : capacity_(capacity) {}
+
+    status_t set_capacity(int capacity);
+    int get_capacity() const;
+
+    // Returns the cached position or -1 if the key is missing.
+    int get(const key_t &key);
+    void add(const key_t &key, int impl_idx);
+
+    int get_size() const;
+    dim_t get_hits() const { return hits_; }
+    dim_t get_misses() const { return misses_; }
+
+private:
+    void evict(size_t n);
+
+    utils::rw_mutex_t &rw_mutex() const { return rw_mutex_; }
+
+    size_t capacity_;
+    using cache_list_t = std::list<std::pair<key_t, int>>;
+    cache_list_t cache_list_;
+    std::unordered_map<key_t, cache_list_t::iterator> cache_mapper_;
+
+    std::atomic<dim_t> hits_ {0};
+    std::atomic<dim_t> misses_ {0};
+
+    mutable utils::rw_mutex_t rw_mutex_;
+};
+
+dispatch_cache_t &dispatch_cache();
+
+// Undocumented API, for testing and profiling only
+status_t DNNL_API get_dispatch_cache_stats(
+        int *size, dim_t *hits, dim_t *misses);
+
+} // namespace impl
+} // namespace dnnl
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <climits>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
@@ -216,18 +218,28 @@ dnnl::impl::status_t post_ops_t::entry_t::set_depthwise_scales(
     return dnnl::impl::status::success;
 }
 
-status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
-        data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+status_t post_ops_t::append_dw(data_type_t wei_dt, data_type_t bias_dt,
+        data_type_t dst_dt, dim_t kernel_size, dim_t stride_size,
+        dim_t padding_l_size, dim_t count, int mask, const float *scales) {
     if (len() == post_ops_limit) return out_of_memory;
     bool ok = wei_dt != data_type::undef && dst_dt != data_type::undef
             && IMPLICATION(count > 0, scales) && mask >= 0;
     if (!ok) return invalid_arguments;
 
+    // Padding is applied symmetrically, so it has to be smaller than the
+    // kernel for every output point to touch at least one input point.
+    ok = kernel_size > 0 && kernel_size <= INT_MAX && stride_size > 0
+            && stride_size <= INT_MAX && padding_l_size >= 0
+            && padding_l_size < kernel_size;
+    if (!ok) return invalid_arguments;
+
     entry_.emplace_back();
     auto &e = entry_.back();
     e.kind = primitive_kind::convolution;
     auto &d = e.depthwise_conv;
-    d.stride = 1;
+    d.kernel = static_cast<int>(kernel_size);
+    d.stride = static_cast<int>(stride_size);
+    d.padding = static_cast<int>(padding_l_size);
     d.wei_dt = wei_dt;
     d.bias_dt = bias_dt;
     d.dst_dt = dst_dt;
@@ -238,15 +250,14 @@ status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
     return e.set_depthwise_scales(scales);
 }
 
-status_t post_ops_t::append_dw_k3s2p1(data_type_t wei_dt, data_type_t bias_dt,
+status_t post_ops_t::append_dw_k3s1p1(data_type_t wei_dt, data_type_t bias_dt,
         data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+    return append_dw(wei_dt, bias_dt, dst_dt, 3, 1, 1, count, mask, scales);
+}
 
-    auto status
-            = append_dw_k3s1p1(wei_dt, bias_dt, dst_dt, count, mask, scales);
-    if (status != success) return status;
-    entry_.back().depthwise_conv.stride = 2;
-
-    return success;
+status_t post_ops_t::append_dw_k3s2p1(data_type_t wei_dt, data_type_t bias_dt,
+        data_type_t dst_dt, dim_t count, int mask, const float *scales) {
+    return append_dw(wei_dt, bias_dt, dst_dt, 3, 2, 1, count, mask, scales);
 }
 
 status_t post_ops_t::append_binary(
@@ -527,7 +538,8 @@ status_t dnnl_post_ops_get_params_dw_k3s1p1(const post_ops_t *post_ops,
         return invalid_arguments;
 
     const auto &d = post_ops->entry_[index].depthwise_conv;
-    if (d.stride != 1) return invalid_arguments;
+    if (d.kernel != 3 || d.stride != 1 || d.padding != 1)
+        return invalid_arguments;
     if (wei_dt) *wei_dt = d.wei_dt;
     if (bias_dt) *bias_dt = d.bias_dt;
     if (dst_dt) *dst_dt = d.dst_dt;
@@ -555,10 +567,43 @@ status_t dnnl_post_ops_get_params_dw_k3s2p1(const post_ops_t *post_ops,
         return invalid_arguments;
 
     const auto &d = post_ops->entry_[index].depthwise_conv;
-    if (d.stride != 2) return invalid_arguments;
+    if (d.kernel != 3 || d.stride != 2 || d.padding != 1)
+        return invalid_arguments;
+    if (wei_dt) *wei_dt = d.wei_dt;
+    if (bias_dt) *bias_dt = d.bias_dt;
+    if (dst_dt) *dst_dt = d.dst_dt;
+    if (count) *count = d.count;
+    if (mask) *mask = d.mask;
+    if (scales) *scales = d.scales;
+
+    return success;
+}
+
+status_t dnnl_post_ops_append_dw(post_ops_t *post_ops, data_type_t wei_dt,
+        data_type_t bias_dt, data_type_t dst_dt, dim_t kernel_size,
+        dim_t stride_size, dim_t padding_l_size, dim_t count, int mask,
+        const float *scales) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_dw(wei_dt, bias_dt, dst_dt, kernel_size,
+            stride_size, padding_l_size, count, mask, scales);
+}
+
+status_t dnnl_post_ops_get_params_dw(const post_ops_t *post_ops, int index,
+        data_type_t *wei_dt, data_type_t *bias_dt, data_type_t *dst_dt,
+        dim_t *kernel_size, dim_t *stride_size, dim_t *padding_l_size,
+        dim_t *count, int *mask, const float **scales) {
+
+    if (!simple_get_params_check(post_ops, index, primitive_kind::convolution))
+        return invalid_arguments;
+
+    const auto &d = post_ops->entry_[index].depthwise_conv;
     if (wei_dt) *wei_dt = d.wei_dt;
     if (bias_dt) *bias_dt = d.bias_dt;
     if (dst_dt) *dst_dt = d.dst_dt;
+    if (kernel_size) *kernel_size = d.kernel;
+    if (stride_size) *stride_size = d.stride;
+    if (padding_l_size) *padding_l_size = d.padding;
     if (count) *count = d.count;
     if (mask) *mask = d.mask;
     if (scales) *scales = d.scales;
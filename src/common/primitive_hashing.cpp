@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -40,6 +40,27 @@ key_t::key_t(const primitive_desc_t *pd, const engine_t *engine, int impl_nthr)
     init_mds(pd);
 }
 
+key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, int impl_nthr,
+        const primitive_desc_t *hint_fwd_pd)
+    : primitive_kind_(op_desc->kind)
+    , op_desc_(op_desc)
+    , attr_(attr ? *attr : primitive_attr_t())
+    , impl_id_(hint_fwd_pd ? hint_fwd_pd->impl_id() : typeid(void))
+    , impl_nthr_(impl_nthr)
+    , engine_kind_(engine ? engine->kind() : engine_kind::any_engine)
+    , runtime_kind_(engine ? engine->runtime_kind() : runtime_kind::none)
+    , device_id_(engine ? engine->device_id() : device_id_t(0, 0, 0)) {
+    // Backward implementations pick their formats based on the forward
+    // hint, so its memory descriptors take part in the key.
+    if (hint_fwd_pd) {
+        mds.push_back(*hint_fwd_pd->src_md(0));
+        mds.push_back(*hint_fwd_pd->weights_md(0));
+        mds.push_back(*hint_fwd_pd->dst_md(0));
+        mds.push_back(*hint_fwd_pd->workspace_md(0));
+    }
+}
+
 void key_t::init_mds(const primitive_desc_t *pd) {
     // Put only **relevant** memory descriptors to the list that might
     // affect the equality. The current cases are:
@@ -291,8 +312,12 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(seed, static_cast<size_t>(entry.sum.dt));
                 break;
             case primitive_kind::convolution:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.depthwise_conv.kernel));
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.stride));
+                seed = hash_combine(seed,
+                        static_cast<size_t>(entry.depthwise_conv.padding));
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.wei_dt));
                 seed = hash_combine(seed,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -207,6 +207,12 @@ private:
 
 struct key_t {
     key_t(const primitive_desc_t *pd, const engine_t *engine, int impl_nthr);
+    // Builds a key from the primitive descriptor creation arguments. It is
+    // used before any implementation is picked, hence the implementation id
+    // and memory descriptors are taken from the forward hint (if any).
+    key_t(const engine_t *engine, const op_desc_t *op_desc,
+            const primitive_attr_t *attr, int impl_nthr,
+            const primitive_desc_t *hint_fwd_pd);
 
     bool operator==(const key_t &other) const;
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dispatch_cache.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_iterator.hpp"
@@ -27,6 +29,48 @@
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 
+void dnnl_primitive_desc_iterator::init_dispatch_key() {
+    if (!is_initialized_ || dispatch_cache().get_capacity() == 0) return;
+    dispatch_key_.reset(new primitive_hashing::key_t(
+            engine_, op_desc_, &attr_, dnnl_get_max_threads(), hint_fwd_pd_));
+}
+
+primitive_desc_iterator_t &dnnl_primitive_desc_iterator::operator++() {
+    pd_.reset();
+
+    // Jump over the implementations known to be unimplemented
+    const bool use_dispatch_cache = idx_ == -1 && dispatch_key_ != nullptr;
+    if (use_dispatch_cache) {
+        const int cached_idx = dispatch_cache().get(*dispatch_key_);
+        if (cached_idx >= 0 && cached_idx <= last_idx_) {
+            idx_ = cached_idx - 1;
+            dispatch_key_.reset();
+        }
+    }
+
+    // Only the `unimplemented` status is a property of the creation
+    // arguments: other failures (e.g. `out_of_memory`) might not repeat.
+    bool skipped_unimplemented_only = true;
+    while (++idx_ != last_idx_) {
+        primitive_desc_t *candidate_pd = nullptr;
+        auto s = impl_list_[idx_](
+                &candidate_pd, op_desc_, &attr_, engine_, hint_fwd_pd_);
+        if (s == success) {
+            pd_.reset(candidate_pd);
+            break;
+        }
+        skipped_unimplemented_only
+                = skipped_unimplemented_only && s == unimplemented;
+    }
+
+    if (dispatch_key_) {
+        if (skipped_unimplemented_only)
+            dispatch_cache().add(*dispatch_key_, idx_);
+        dispatch_key_.reset();
+    }
+    return *this;
+}
+
 status_t dnnl_primitive_desc_iterator_create(
         primitive_desc_iterator_t **iterator, const_c_op_desc_t c_op_desc,
         const primitive_attr_t *attr, engine_t *engine,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include "engine.hpp"
 #include "primitive_attr.hpp"
 #include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
 #include "type_helpers.hpp"
 
 struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
@@ -42,6 +43,7 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         while (impl_list_[last_idx_] != nullptr)
             ++last_idx_;
         is_initialized_ = is_initialized_ && attr_.is_initialized();
+        init_dispatch_key();
     }
 
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -57,19 +59,7 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         return dnnl_primitive_desc_iterator(engine_, last_idx_);
     }
 
-    dnnl::impl::primitive_desc_iterator_t &operator++() {
-        pd_.reset();
-        while (++idx_ != last_idx_) {
-            dnnl::impl::primitive_desc_t *candidate_pd = nullptr;
-            auto s = impl_list_[idx_](
-                    &candidate_pd, op_desc_, &attr_, engine_, hint_fwd_pd_);
-            if (s == dnnl::impl::status::success) {
-                pd_.reset(candidate_pd);
-                break;
-            }
-        }
-        return *this;
-    }
+    dnnl::impl::primitive_desc_iterator_t &operator++();
 
     dnnl::impl::primitive_desc_t *operator*() const {
         if (*this == end() || pd_ == nullptr) return nullptr;
@@ -101,7 +91,14 @@ protected:
     const pd_create_f *impl_list_;
     int last_idx_;
 
+    // Key of the dispatch cache entry. It is reset after the first
+    // successful implementation is found, since the cache only helps to
+    // skip the implementations in front of it.
+    std::unique_ptr<dnnl::impl::primitive_hashing::key_t> dispatch_key_;
+
 private:
+    void init_dispatch_key();
+
     dnnl_primitive_desc_iterator(dnnl::impl::engine_t *engine, int last_idx)
         : idx_(last_idx)
         , engine_(engine)
@@ -117,7 +114,8 @@ private:
         , op_desc_(other.op_desc_)
         , attr_(other.attr_)
         , hint_fwd_pd_(other.hint_fwd_pd_)
-        , impl_list_(other.impl_list_) {}
+        , impl_list_(other.impl_list_)
+        , dispatch_key_(std::move(other.dispatch_key_)) {}
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_desc_iterator);
 };
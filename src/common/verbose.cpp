@@ -287,7 +287,8 @@ void attr2str(char *str, int len, int written, const primitive_attr_t *attr) {
                 case primitive_kind::convolution: {
                     using namespace data_type;
                     const auto &c = e.depthwise_conv;
-                    DPRINT(str, len, written, "dw_k3s%dp1", c.stride);
+                    DPRINT(str, len, written, "dw_k%ds%dp%d", c.kernel,
+                            c.stride, c.padding);
                     if (c.wei_dt == s8) {
                         DPRINT(str, len, written, ":%s:%d",
                                 dnnl_dt2str(c.dst_dt), c.mask);
@@ -19,6 +19,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_concat.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -28,15 +33,19 @@ using cpd_create_f = dnnl::impl::engine_t::concat_primitive_desc_create_f;
 namespace {
 // clang-format off
 #define INSTANCE(...) __VA_ARGS__::pd_t::create,
+#define INSTANCE_X64(...) DNNL_X64_ONLY(INSTANCE(__VA_ARGS__))
 const cpd_create_f cpu_concat_impl_list[] = {
         INSTANCE(simple_concat_t<data_type::f32>)
         INSTANCE(simple_concat_t<data_type::u8>)
         INSTANCE(simple_concat_t<data_type::s8>)
         INSTANCE(simple_concat_t<data_type::s32>)
         INSTANCE(simple_concat_t<data_type::bf16>)
+        INSTANCE_X64(jit_uni_concat_t<avx512_core>)
+        INSTANCE_X64(jit_uni_concat_t<avx2>)
         INSTANCE(ref_concat_t)
         nullptr,
 };
+#undef INSTANCE_X64
 #undef INSTANCE
 // clang-format on
 } // namespace
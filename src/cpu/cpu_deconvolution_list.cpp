@@ -21,6 +21,7 @@
 #if DNNL_X64
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_deconvolution.hpp"
+#include "cpu/x64/jit_brgemm_deconvolution.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_deconvolution.hpp"
 using namespace dnnl::impl::cpu::x64;
@@ -85,6 +86,8 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(_jit_uni_x8s8s32x_deconvolution_fwd_t<sse41, s8, u8>)
         CPU_INSTANCE_X64(_jit_uni_x8s8s32x_deconvolution_fwd_t<sse41, s8, s8>)
         CPU_INSTANCE_X64(_jit_uni_x8s8s32x_deconvolution_fwd_t<sse41, s8, f32>)
+        CPU_INSTANCE_X64(brgemm_deconvolution_fwd_t<avx512_core_bf16>)
+        CPU_INSTANCE_X64(brgemm_deconvolution_fwd_t<avx512_core>)
         CPU_INSTANCE(ref_deconvolution_bwd_weights_t)
         CPU_INSTANCE(ref_deconvolution_bwd_data_t)
         CPU_INSTANCE(ref_deconvolution_fwd_t)
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -47,6 +47,8 @@ const pd_create_f impl_list[] = {
         CPU_INSTANCE(simple_resampling_bwd_t<bf16>)
         CPU_INSTANCE(ref_resampling_fwd_t<f32>)
         CPU_INSTANCE(ref_resampling_fwd_t<bf16>)
+        CPU_INSTANCE(ref_resampling_fwd_t<s8>)
+        CPU_INSTANCE(ref_resampling_fwd_t<u8>)
         CPU_INSTANCE(ref_resampling_bwd_t<f32>)
         CPU_INSTANCE(ref_resampling_bwd_t<bf16>)
         /* eol */
@@ -21,6 +21,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_avx512_core_bf16_sum.hpp"
+#include "cpu/x64/jit_uni_sum.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
@@ -40,6 +41,8 @@ const spd_create_f cpu_sum_impl_list[] = {
         INSTANCE(simple_sum_t<data_type::bf16>)
         INSTANCE(simple_sum_t<data_type::bf16, data_type::f32>)
         INSTANCE(simple_sum_t<data_type::f32>)
+        INSTANCE_X64(jit_uni_sum_t<avx512_core>)
+        INSTANCE_X64(jit_uni_sum_t<avx2>)
         INSTANCE(ref_sum_t)
         nullptr,
 };
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -65,15 +65,22 @@ inline status_t get_depthwise_conv_desc(convolution_desc_t &cd_dw,
     const auto g = src_dw_d.dims()[1];
     const auto ih = src_dw_d.dims()[ndims - 2];
     const auto iw = src_dw_d.dims()[ndims - 1];
+    const auto kernel = dw_po.kernel;
     const auto stride = dw_po.stride;
+    const auto padding = dw_po.padding;
 
-    const dims_t weights_tz = {g, 1, 1, 3, 3};
+    // Padding is symmetric, hence the output size follows the regular
+    // convolution formula with padding_l == padding_r.
+    const auto oh = (ih + 2 * padding - kernel) / stride + 1;
+    const auto ow = (iw + 2 * padding - kernel) / stride + 1;
+    if (oh <= 0 || ow <= 0) return status::unimplemented;
 
-    const dims_t dst_tz
-            = {n, oc, utils::div_up(ih, stride), utils::div_up(iw, stride)};
+    const dims_t weights_tz = {g, 1, 1, kernel, kernel};
+
+    const dims_t dst_tz = {n, oc, oh, ow};
 
     const dims_t bias_tz = {oc};
-    const dims_t pad_tz = {1, 1};
+    const dims_t pad_tz = {padding, padding};
     const dims_t stride_tz = {stride, stride};
 
     memory_desc_t src_md, weights_md, bias_md, dst_md;
@@ -40,7 +40,9 @@ struct ref_concat_t : public primitive_t {
         DECLARE_CONCAT_PD_T("ref:any", ref_concat_t);
 
         status_t init(engine_t *engine) {
-            status_t status = cpu_concat_pd_t::init();
+            using sm = primitive_attr_t::skip_mask_t;
+            const auto attr_mask = sm::scales | sm::zero_points;
+            status_t status = cpu_concat_pd_t::init(nullptr, attr_mask);
             if (status != status::success) {
                 assert(dst_md_.format_kind != format_kind::undef);
                 status = dnnl_memory_desc_init_by_strides(&tent_dst_md_,
@@ -48,16 +50,31 @@ struct ref_concat_t : public primitive_t {
                         nullptr);
                 if (status != status::success) return status::unimplemented;
 
-                status = cpu_concat_pd_t::init(&tent_dst_md_);
+                status = cpu_concat_pd_t::init(&tent_dst_md_, attr_mask);
                 if (status != status::success) return status::unimplemented;
             }
 
+            // dst zero point is applied by the reorders that write directly
+            // into dst, the intermediate tensor would saturate too early
+            const auto &zp = attr()->zero_points_;
+            bool ok = zp.has_default_values(DNNL_ARG_SRC)
+                    && zp.has_default_values(DNNL_ARG_WEIGHTS)
+                    && IMPLICATION(!zp.has_default_values(DNNL_ARG_DST),
+                            !use_tent_dst() && zp.defined(DNNL_ARG_DST)
+                                    && zp.common(DNNL_ARG_DST));
+            if (!ok) return status::unimplemented;
+
             for (int i = 0; i < n_; ++i) {
                 auto r_impls = engine->get_reorder_implementation_list(
                         src_md(i), src_image_md(i));
                 for (auto r = r_impls; *r; ++r) {
-                    primitive_attr_t r_attr; /* alpha == 1. */
+                    primitive_attr_t r_attr;
                     r_attr.set_scratchpad_mode(scratchpad_mode::user);
+                    if (src_scale(i) != 1.f)
+                        r_attr.output_scales_.set(src_scale(i));
+                    if (!zp.has_default_values(DNNL_ARG_DST))
+                        r_attr.zero_points_.set(
+                                DNNL_ARG_DST, *zp.get(DNNL_ARG_DST));
                     reorder_pd_t *r_pd = nullptr;
 
                     if ((*r)(&r_pd, engine, &r_attr, engine, src_md(i), engine,
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_IO_HELPER_HPP
+#define CPU_REF_IO_HELPER_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace io {
+
+// Helpers for reference implementations which data types are known at
+// primitive descriptor creation time only.
+
+inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
+    return types::get_float_value(dt, ptr, idx);
+}
+
+inline void store_float_value(data_type_t dt, float val, void *ptr, dim_t idx) {
+#define CASE(dt) \
+    case dt: { \
+        using type_ = typename prec_traits<dt>::type; \
+        ((type_ *)ptr)[idx] = cpu::saturate_and_round<type_>(val); \
+    } break;
+
+    using namespace data_type;
+    switch (dt) {
+        CASE(bf16);
+        CASE(f16);
+        CASE(f32);
+        CASE(s32);
+        CASE(s8);
+        CASE(u8);
+        default: assert(!"bad data_type");
+    }
+
+#undef CASE
+}
+
+} // namespace io
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -22,6 +22,8 @@
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_pooling.hpp"
@@ -44,16 +46,20 @@ static inline dim_t get_offset(
 using namespace nstl;
 
 template <data_type_t data_type, data_type_t acc_type>
-void ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
+status_t ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
         const exec_ctx_t &ctx) const {
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
     auto ws = CTX_OUT_MEM(unsigned char *, DNNL_ARG_WORKSPACE);
 
+    DEFINE_SCALES_BUFFER(scales);
+    const bool with_scales = !pd()->attr()->output_scales_.has_default_values();
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper ws_d(pd()->workspace_md());
+    const data_type_t dst_dt = dst_d.data_type();
 
     auto alg = pd()->desc()->alg_kind;
     const data_type_t ws_dt = ws ? ws_d.data_type() : data_type::undef;
@@ -174,13 +180,15 @@ void ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
                     set_ws(mb, oc, od, oh, ow, 0);
                     ker_max(res, mb, oc, od, oh, ow);
 
+                    if (with_scales) res *= scales[0];
+
                     ref_post_ops_t::args_t args;
                     args.ctx = &ctx;
                     args.l_offset = data_l_off;
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(res, args);
 
-                    dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
+                    io::store_float_value(dst_dt, res, dst, data_p_off);
                 });
     } else {
         parallel_nd(MB, OC, OD, OH, OW,
@@ -191,15 +199,19 @@ void ref_pooling_fwd_t<data_type, acc_type>::execute_forward(
                     float res = 0.f;
                     ker_avg(res, mb, oc, od, oh, ow);
 
+                    if (with_scales) res *= scales[0];
+
                     ref_post_ops_t::args_t args;
                     args.ctx = &ctx;
                     args.l_offset = data_l_off;
                     args.dst_md = pd()->dst_md();
                     ref_post_ops->execute(res, args);
 
-                    dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
+                    io::store_float_value(dst_dt, res, dst, data_p_off);
                 });
     }
+
+    return status::success;
 }
 
 template <data_type_t data_type>
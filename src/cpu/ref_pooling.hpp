@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2020 Intel Corporation
+* Copyright 2016-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -41,14 +41,22 @@ struct ref_pooling_fwd_t : public primitive_t {
         DECLARE_COMMON_PD_T("ref:any", ref_pooling_fwd_t);
 
         status_t init(engine_t *engine) {
+            using namespace data_type;
             using sm = primitive_attr_t::skip_mask_t;
 
+            const data_type_t dst_dt = dst_md()->data_type;
             bool ok = platform::has_data_type_support(data_type)
+                    && platform::has_data_type_support(dst_dt)
                     && set_default_params() == status::success && is_fwd()
-                    && utils::everyone_is(
-                            data_type, src_md()->data_type, dst_md()->data_type)
-                    && desc()->accum_data_type == acc_type
-                    && attr()->has_default_values(sm::post_ops);
+                    && src_md()->data_type == data_type
+                    && IMPLICATION(dst_dt != data_type,
+                            utils::one_of(data_type, f32, bf16, s8, u8)
+                                    && utils::one_of(dst_dt, f32, bf16, s8, u8))
+                    && IMPLICATION(dst_dt == data_type,
+                            desc()->accum_data_type == acc_type)
+                    && attr()->has_default_values(
+                            sm::post_ops | sm::oscale_runtime, dst_dt)
+                    && attr()->output_scales_.mask_ == 0;
             if (!ok) return status::unimplemented;
 
             bool is_training = desc_.prop_kind == prop_kind::forward_training;
@@ -72,13 +80,12 @@ struct ref_pooling_fwd_t : public primitive_t {
     using acc_data_t = typename prec_traits<acc_type>::type;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -23,6 +23,8 @@
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/resampling_utils.hpp"
 
 #include "cpu/ref_resampling.hpp"
@@ -44,15 +46,19 @@ static inline dim_t get_offset(
 using namespace resampling_utils;
 
 template <impl::data_type_t data_type>
-void ref_resampling_fwd_t<data_type>::execute_forward(
+status_t ref_resampling_fwd_t<data_type>::execute_forward(
         const exec_ctx_t &ctx) const {
-    if (this->pd()->has_zero_dim_memory()) return;
+    if (this->pd()->has_zero_dim_memory()) return status::success;
 
     const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+    const bool with_scales = !pd()->attr()->output_scales_.has_default_values();
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
+    const data_type_t dst_dt = dst_d.data_type();
 
     const auto alg = pd()->desc()->alg_kind;
 
@@ -81,12 +87,12 @@ void ref_resampling_fwd_t<data_type>::execute_forward(
     };
     parallel_nd(MB, C, OD, OH, OW,
             [&](dim_t mb, dim_t ch, dim_t od, dim_t oh, dim_t ow) {
+                float res = 0.f;
                 if (alg == alg_kind::resampling_nearest) {
                     const dim_t id = nearest_idx(od, OD, ID);
                     const dim_t ih = nearest_idx(oh, OH, IH);
                     const dim_t iw = nearest_idx(ow, OW, IW);
-                    dst[get_offset(dst_d, mb, ch, od, oh, ow)]
-                            = src[get_offset(src_d, mb, ch, id, ih, iw)];
+                    res = src[get_offset(src_d, mb, ch, id, ih, iw)];
                 } else if (alg == alg_kind::resampling_linear) {
                     // Trilinear interpolation (linear interpolation on a 3D spatial
                     // tensor) can be expressed as linear interpolation along
@@ -109,16 +115,32 @@ void ref_resampling_fwd_t<data_type>::execute_forward(
                         src_l[4 * i + 2 * j + k] = src[get_offset(src_d, mb, ch,
                                 id.idx[i], ih.idx[j], iw.idx[k])];
                     }
-                    dst[get_offset(dst_d, mb, ch, od, oh, ow)]
-                            = trilin_interp(src_l[0], src_l[1], src_l[2],
-                                    src_l[3], src_l[4], src_l[5], src_l[6],
-                                    src_l[7], id.wei[0], ih.wei[0], iw.wei[0]);
+                    res = trilin_interp(src_l[0], src_l[1], src_l[2],
+                            src_l[3], src_l[4], src_l[5], src_l[6], src_l[7],
+                            id.wei[0], ih.wei[0], iw.wei[0]);
                 }
+
+                if (with_scales) res *= scales[0];
+
+                const dim_t dst_off = get_offset(dst_d, mb, ch, od, oh, ow);
+
+                ref_post_ops_t::args_t args;
+                args.dst_val = io::load_float_value(dst_dt, dst, dst_off);
+                args.ctx = &ctx;
+                args.l_offset = (((mb * C + ch) * OD + od) * OH + oh) * OW + ow;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops->execute(res, args);
+
+                io::store_float_value(dst_dt, res, dst, dst_off);
             });
+
+    return status::success;
 }
 
 template struct ref_resampling_fwd_t<data_type::f32>;
 template struct ref_resampling_fwd_t<data_type::bf16>;
+template struct ref_resampling_fwd_t<data_type::s8>;
+template struct ref_resampling_fwd_t<data_type::u8>;
 
 template <impl::data_type_t data_type>
 void ref_resampling_bwd_t<data_type>::execute_backward(
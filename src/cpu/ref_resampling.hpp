@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/cpu_resampling_pd.hpp"
 
@@ -41,12 +42,17 @@ struct ref_resampling_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
-            bool ok = is_fwd()
-                    && utils::everyone_is(
-                            data_type, src_md()->data_type, dst_md()->data_type)
+            using sm = primitive_attr_t::skip_mask_t;
+
+            const data_type_t dst_dt = dst_md()->data_type;
+            bool ok = is_fwd() && src_md()->data_type == data_type
+                    && utils::one_of(dst_dt, f32, bf16, s8, u8)
                     && platform::has_data_type_support(data_type)
+                    && platform::has_data_type_support(dst_dt)
                     && set_default_params() == status::success
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(
+                            sm::oscale_runtime | sm::post_ops, dst_dt)
+                    && attr()->output_scales_.mask_ == 0;
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -57,16 +63,23 @@ struct ref_resampling_fwd_t : public primitive_t {
 
     ~ref_resampling_fwd_t() {}
 
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
     typedef typename prec_traits<data_type>::type data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
 template <impl::data_type_t data_type>
@@ -0,0 +1,661 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/x64/gemm_wino_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Channels are processed in chunks that are contiguous in both nhwc and
+// nChw8c layouts.
+constexpr int simd_w = 8;
+
+// Scales applied to int8 source and transformed weights to keep the values
+// in Winograd domain within 8 bits.
+const float adj_src_scale = 1.f / 4.f;
+const float adj_wei_scale = 4.f / 9.f;
+
+// 1D transforms of F(m, 3) applied to simd_w channels at once. Inputs and
+// outputs are arrays of simd_w values placed `xs` and `ys` elements apart.
+// The 2D transforms of F(m x m, 3 x 3) are
+//     Y = AT * [(G * g * GT) . (BT * d * B)] * A
+// and are computed as 1D transforms of columns followed by the ones of rows.
+template <int m>
+struct wino_transform_t;
+
+template <>
+struct wino_transform_t<2> {
+    static constexpr int alpha = 4;
+
+    // G: 3 -> alpha
+    static void wei(const float *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc];
+            y[cc] = x0;
+            y[ys + cc] = .5f * (x0 + x1 + x2);
+            y[2 * ys + cc] = .5f * (x0 - x1 + x2);
+            y[3 * ys + cc] = x2;
+        }
+    }
+
+    // BT: alpha -> alpha
+    static void src(const float *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc],
+                        x3 = x[3 * xs + cc];
+            y[cc] = x0 - x2;
+            y[ys + cc] = x1 + x2;
+            y[2 * ys + cc] = x2 - x1;
+            y[3 * ys + cc] = x1 - x3;
+        }
+    }
+
+    // AT: alpha -> m
+    template <typename T>
+    static void dst(const T *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc],
+                        x3 = x[3 * xs + cc];
+            y[cc] = x0 + x1 + x2;
+            y[ys + cc] = x1 - x2 - x3;
+        }
+    }
+
+    // Both BT rows defining the point have no negative entries, so the point
+    // is non-negative for non-negative source.
+    static bool is_unsigned_point(int i, int j) { return i == 1 && j == 1; }
+};
+
+template <>
+struct wino_transform_t<4> {
+    static constexpr int alpha = 6;
+
+    static void wei(const float *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc];
+            y[cc] = x0 / 4.f;
+            y[ys + cc] = -(x0 + x1 + x2) / 6.f;
+            y[2 * ys + cc] = -(x0 - x1 + x2) / 6.f;
+            y[3 * ys + cc] = x0 / 24.f + x1 / 12.f + x2 / 6.f;
+            y[4 * ys + cc] = x0 / 24.f - x1 / 12.f + x2 / 6.f;
+            y[5 * ys + cc] = x2;
+        }
+    }
+
+    static void src(const float *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc],
+                        x3 = x[3 * xs + cc], x4 = x[4 * xs + cc],
+                        x5 = x[5 * xs + cc];
+            y[cc] = 4.f * x0 - 5.f * x2 + x4;
+            y[ys + cc] = -4.f * (x1 + x2) + x3 + x4;
+            y[2 * ys + cc] = 4.f * (x1 - x2) - x3 + x4;
+            y[3 * ys + cc] = 2.f * (x3 - x1) - x2 + x4;
+            y[4 * ys + cc] = 2.f * (x1 - x3) - x2 + x4;
+            y[5 * ys + cc] = 4.f * x1 - 5.f * x3 + x5;
+        }
+    }
+
+    template <typename T>
+    static void dst(const T *x, dim_t xs, float *y, dim_t ys) {
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++) {
+            const float x0 = x[cc], x1 = x[xs + cc], x2 = x[2 * xs + cc],
+                        x3 = x[3 * xs + cc], x4 = x[4 * xs + cc],
+                        x5 = x[5 * xs + cc];
+            y[cc] = x0 + x1 + x2 + x3 + x4;
+            y[ys + cc] = x1 - x2 + 2.f * (x3 - x4);
+            y[2 * ys + cc] = x1 + x2 + 4.f * (x3 + x4);
+            y[3 * ys + cc] = x1 - x2 + 8.f * (x3 - x4) + x5;
+        }
+    }
+
+    // Not used: int8 is limited to F(2x2, 3x3).
+    static bool is_unsigned_point(int i, int j) { return false; }
+};
+
+struct tile_t {
+    dim_t n;
+    int h, w; // top left point in output
+};
+
+inline tile_t get_tile(const gemm_wino_conf_t &jcp, dim_t t) {
+    tile_t tile;
+    const int tw = t % jcp.tiles_w;
+    t /= jcp.tiles_w;
+    const int th = t % jcp.tiles_h;
+    tile.n = t / jcp.tiles_h;
+    tile.h = th * jcp.m;
+    tile.w = tw * jcp.m;
+    return tile;
+}
+
+// Offset of a channels chunk started at `c` in nhwc or nChw8c tensor.
+inline dim_t chunk_off(const memory_desc_wrapper &md, bool is_nspc, int c) {
+    return is_nspc ? c : (c / simd_w) * md.blocking_desc().strides[1];
+}
+
+// Pointers to `size x size` spatial points of a tile with the top left point
+// at (h, w) of image `n`, nullptr for the points out of the tensor.
+template <typename data_t>
+void get_tile_points(const memory_desc_wrapper &md, data_t *base, dim_t n,
+        int h, int w, int size, data_t **pts) {
+    const auto &strides = md.blocking_desc().strides;
+    const int H = md.dims()[2], W = md.dims()[3];
+    for_(int i = 0; i < size; i++)
+    for (int j = 0; j < size; j++) {
+        const bool in_bounds
+                = h + i >= 0 && h + i < H && w + j >= 0 && w + j < W;
+        pts[i * size + j] = in_bounds ? base + md.offset0() + n * strides[0]
+                        + (h + i) * strides[2] + (w + j) * strides[3]
+                                      : nullptr;
+    }
+}
+
+// Transforms weights to Winograd domain: U[p][ic][oc]. For int8 the result is
+// quantized and compensation for the shift of source is computed per point.
+template <int m, typename wei_data_t>
+void transform_weights(const gemm_wino_conf_t &jcp,
+        const memory_desc_wrapper &wei_d, const wei_data_t *wei,
+        wei_data_t *wino_wei, int32_t *comp) {
+    using wt = wino_transform_t<m>;
+    constexpr int alpha = wt::alpha;
+    constexpr bool is_int8 = std::is_same<wei_data_t, int8_t>::value;
+    const dim_t p_stride = jcp.U_p_stride;
+    const auto &strides = wei_d.blocking_desc().strides;
+    const dim_t kh_stride = strides[jcp.with_groups + 2];
+    const dim_t kw_stride = strides[jcp.with_groups + 3];
+
+    // Output channels are the innermost dimension of U, so they are
+    // transformed simd_w at a time to keep the stores sequential.
+    parallel_nd(jcp.ic, div_up(jcp.oc, simd_w), [&](int ic, int ocb) {
+        const int oc = ocb * simd_w;
+        const int cb = ic < jcp.ic_without_padding
+                ? nstl::max(0, nstl::min(simd_w, jcp.oc_without_padding - oc))
+                : 0;
+        float g[3][3][simd_w] = {{{0.f}}};
+        if (cb > 0) {
+            // Output channels of a chunk are dense in supported layouts.
+            const wei_data_t *w_oc = &wei[jcp.with_groups
+                            ? wei_d.off(0, oc, ic, 0, 0)
+                            : wei_d.off(oc, ic, 0, 0)];
+            for_(int kh = 0; kh < 3; kh++)
+            for_(int kw = 0; kw < 3; kw++)
+            for (int cc = 0; cc < cb; cc++)
+                g[kh][kw][cc] = w_oc[kh * kh_stride + kw * kw_stride + cc];
+        }
+
+        float tmp[alpha][3][simd_w], u[alpha][alpha][simd_w];
+        for (int j = 0; j < 3; j++)
+            wt::wei(&g[0][j][0], 3 * simd_w, &tmp[0][j][0], 3 * simd_w);
+        for (int i = 0; i < alpha; i++)
+            wt::wei(&tmp[i][0][0], simd_w, &u[i][0][0], simd_w);
+
+        const int ob = nstl::min(simd_w, jcp.oc - oc);
+        wei_data_t *w = wino_wei + (dim_t)ic * jcp.oc + oc;
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            wei_data_t *wp = w + (i * alpha + j) * p_stride;
+            PRAGMA_OMP_SIMD()
+            for (int cc = 0; cc < ob; cc++)
+                wp[cc] = is_int8 ? saturate_and_round<wei_data_t>(
+                                 u[i][j][cc] * adj_wei_scale)
+                                 : u[i][j][cc];
+        }
+    });
+
+    if (!is_int8) return;
+    parallel_nd(alpha, alpha, [&](int i, int j) {
+        const int p = i * alpha + j;
+        int32_t *c = comp + p * jcp.oc;
+        for (int oc = 0; oc < jcp.oc; oc++)
+            c[oc] = 0;
+        if (wt::is_unsigned_point(i, j)) return;
+        for (int ic = 0; ic < jcp.ic; ic++) {
+            const wei_data_t *u = wino_wei + p * p_stride + (dim_t)ic * jcp.oc;
+            PRAGMA_OMP_SIMD()
+            for (int oc = 0; oc < jcp.oc; oc++)
+                c[oc] += (int32_t)u[oc];
+        }
+        for (int oc = 0; oc < jcp.oc; oc++)
+            c[oc] *= -128;
+    });
+}
+
+// Transforms `cb` channels of a source tile: V[p][tile][ic].
+template <int m, typename src_data_t>
+void transform_src_tile(const src_data_t *const *pts, dim_t c_off, int cb,
+        src_data_t *wino_src, dim_t p_stride) {
+    using wt = wino_transform_t<m>;
+    constexpr int alpha = wt::alpha;
+    constexpr bool is_int8 = std::is_same<src_data_t, uint8_t>::value;
+
+    float d[alpha][alpha][simd_w];
+    for_(int i = 0; i < alpha; i++)
+    for (int j = 0; j < alpha; j++) {
+        const src_data_t *s = pts[i * alpha + j];
+        if (s != nullptr && cb == simd_w) {
+            s += c_off;
+            PRAGMA_OMP_SIMD()
+            for (int cc = 0; cc < simd_w; cc++)
+                d[i][j][cc] = is_int8 ? nearbyintf(s[cc] * adj_src_scale)
+                                      : s[cc];
+            continue;
+        }
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++)
+            d[i][j][cc] = 0.f;
+        if (s == nullptr) continue;
+        s += c_off;
+        for (int cc = 0; cc < cb; cc++)
+            d[i][j][cc] = is_int8 ? nearbyintf(s[cc] * adj_src_scale) : s[cc];
+    }
+
+    float tmp[alpha][alpha][simd_w], v[alpha][alpha][simd_w];
+    for (int j = 0; j < alpha; j++)
+        wt::src(&d[0][j][0], alpha * simd_w, &tmp[0][j][0], alpha * simd_w);
+    for (int i = 0; i < alpha; i++)
+        wt::src(&tmp[i][0][0], simd_w, &v[i][0][0], simd_w);
+
+    for_(int i = 0; i < alpha; i++)
+    for (int j = 0; j < alpha; j++) {
+        src_data_t *ws = wino_src + (i * alpha + j) * p_stride;
+        if (is_int8) {
+            const bool is_unsigned = wt::is_unsigned_point(i, j);
+            for (int cc = 0; cc < cb; cc++) {
+                const float x = v[i][j][cc];
+                ws[cc] = saturate_and_round<src_data_t>(is_unsigned
+                                ? x
+                                : nstl::min(nstl::max(x, -128.f), 127.f)
+                                        + 128.f);
+            }
+        } else {
+            for (int cc = 0; cc < cb; cc++)
+                ws[cc] = v[i][j][cc];
+        }
+    }
+}
+
+// Transforms `cb` channels of a destination tile from M[p][tile][oc] and
+// stores the result with bias, output scales and post-ops applied.
+template <int m, typename acc_data_t, typename dst_data_t>
+void transform_dst_tile(const gemm_wino_conf_t &jcp, dst_data_t *const *pts,
+        dim_t c_off, int cb, const acc_data_t *wino_dst, dim_t p_stride,
+        float wino_scale, const float *bias, const float *scales,
+        const ref_eltwise_scalar_fwd_t *eltwise) {
+    using wt = wino_transform_t<m>;
+    constexpr int alpha = wt::alpha;
+
+    float tmp[m][alpha][simd_w], y[m][m][simd_w];
+    for (int j = 0; j < alpha; j++)
+        wt::dst(wino_dst + j * p_stride, alpha * p_stride, &tmp[0][j][0],
+                alpha * simd_w);
+    for (int i = 0; i < m; i++)
+        wt::dst(&tmp[i][0][0], simd_w, &y[i][0][0], simd_w);
+
+    for_(int i = 0; i < m; i++)
+    for (int j = 0; j < m; j++) {
+        if (pts[i * m + j] == nullptr) continue;
+        dst_data_t *d = pts[i * m + j] + c_off;
+
+        float v[simd_w];
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < simd_w; cc++)
+            v[cc] = (y[i][j][cc] * wino_scale + bias[cc]) * scales[cc];
+        if (jcp.with_sum) {
+            PRAGMA_OMP_SIMD()
+            for (int cc = 0; cc < cb; cc++)
+                v[cc] += jcp.sum_scale * (float)d[cc];
+        }
+        if (jcp.with_relu) {
+            const float ns = eltwise->alpha_, scale = eltwise->scale_;
+            PRAGMA_OMP_SIMD()
+            for (int cc = 0; cc < simd_w; cc++)
+                v[cc] = (v[cc] > 0.f ? v[cc] : v[cc] * ns) * scale;
+        } else if (jcp.with_eltwise) {
+            for (int cc = 0; cc < cb; cc++)
+                v[cc] = eltwise->compute_scalar(v[cc]);
+        }
+        PRAGMA_OMP_SIMD()
+        for (int cc = 0; cc < cb; cc++)
+            d[cc] = saturate_and_round<dst_data_t>(v[cc]);
+    }
+}
+
+} // namespace
+
+namespace gemm_wino_convolution_utils {
+
+// Direct implementations are preferred on AVX-512 capable processors, for
+// int8, where F(2x2, 3x3) does not save enough multiplications to pay for
+// the transforms, and for problems with too few output points to amortize
+// the transform of weights done at each execution.
+static bool is_winograd_faster_than_direct(
+        const gemm_wino_conf_t &jcp, bool is_int8) {
+    const dim_t work_per_weight = (dim_t)jcp.mb * jcp.oh * jcp.ow;
+    return !mayiuse(avx512_core) && !is_int8 && jcp.ic >= 32 && jcp.oc >= 32
+            && work_per_weight >= 4 * nstl::max(jcp.ic, jcp.oc)
+            && jcp.ntiles >= (dim_t)4 * jcp.nthr;
+}
+
+static bool post_ops_ok(gemm_wino_conf_t &jcp, const primitive_attr_t &attr,
+        data_type_t dst_dt) {
+    const auto &po = attr.post_ops_;
+    auto is_sum = [&](int idx) {
+        return po.entry_[idx].is_sum(false)
+                && utils::one_of(po.entry_[idx].sum.dt, data_type::undef,
+                        dst_dt);
+    };
+    auto is_eltwise = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+
+    switch (po.len()) {
+        case 0: return true;
+        case 1: return is_sum(0) || is_eltwise(0);
+        case 2: return is_sum(0) && is_eltwise(1);
+        default: return false;
+    }
+}
+
+status_t init_conf(gemm_wino_conf_t &jcp,
+        memory_tracking::registrar_t &scratchpad, const convolution_desc_t &cd,
+        const memory_desc_t &src_md, const memory_desc_t &weights_md,
+        const memory_desc_t &dst_md, const memory_desc_t &bias_md,
+        const primitive_attr_t &attr, int max_threads) {
+    using namespace format_tag;
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper wei_d(&weights_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    if (src_d.ndims() != 4) return status::unimplemented;
+
+    const bool with_groups = wei_d.ndims() == src_d.ndims() + 1;
+    if (with_groups && wei_d.dims()[0] != 1) return status::unimplemented;
+
+    jcp.nthr = max_threads;
+    jcp.with_groups = with_groups;
+    jcp.mb = src_d.dims()[0];
+    jcp.ic = jcp.ic_without_padding = src_d.dims()[1];
+    jcp.oc = jcp.oc_without_padding = dst_d.dims()[1];
+    jcp.ih = src_d.dims()[2];
+    jcp.iw = src_d.dims()[3];
+    jcp.oh = dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[3];
+    jcp.t_pad = cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][1];
+    const int b_pad = cd.padding[1][0];
+    const int r_pad = cd.padding[1][1];
+
+    const int kh = wei_d.dims()[with_groups + 2];
+    const int kw = wei_d.dims()[with_groups + 3];
+    const bool shape_ok = everyone_is(3, kh, kw)
+            && everyone_is(1, cd.strides[0], cd.strides[1])
+            && everyone_is(0, cd.dilates[0], cd.dilates[1])
+            && utils::everyone_is(true, jcp.t_pad >= 0, jcp.l_pad >= 0,
+                    b_pad >= 0, r_pad >= 0)
+            && utils::everyone_is(true, jcp.t_pad < 3, jcp.l_pad < 3,
+                    b_pad < 3, r_pad < 3);
+    if (!shape_ok) return status::unimplemented;
+
+    const format_tag_t dat_tag = src_d.matches_one_of_tag(nhwc, nChw8c);
+    if (dat_tag == format_tag::undef || !dst_d.matches_tag(dat_tag))
+        return status::unimplemented;
+    jcp.is_nspc = dat_tag == nhwc;
+    if (!jcp.is_nspc) {
+        jcp.ic = rnd_up(jcp.ic, simd_w);
+        jcp.oc = rnd_up(jcp.oc, simd_w);
+    }
+
+    // Weights are transformed at execution time, output channels are
+    // expected to be dense.
+    const format_tag_t wei_tag = with_groups
+            ? wei_d.matches_one_of_tag(gOIhw8i8o, hwigo)
+            : wei_d.matches_one_of_tag(OIhw8i8o, hwio);
+    if (wei_tag == format_tag::undef) return status::unimplemented;
+
+    const bool is_int8 = src_d.data_type() == data_type::u8;
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+    jcp.bia_dt = jcp.with_bias ? bias_md.data_type : data_type::undef;
+
+    if (!post_ops_ok(jcp, attr, dst_d.data_type()))
+        return status::unimplemented;
+    const auto &po = attr.post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    const int eltwise_idx = po.find(primitive_kind::eltwise);
+    jcp.with_sum = sum_idx != -1;
+    jcp.sum_scale = jcp.with_sum ? po.entry_[sum_idx].sum.scale : 1.f;
+    jcp.with_eltwise = eltwise_idx != -1;
+    jcp.with_relu = jcp.with_eltwise
+            && po.entry_[eltwise_idx].eltwise.alg == alg_kind::eltwise_relu;
+
+    const int oscale_mask = attr.output_scales_.mask_;
+    if (!utils::one_of(oscale_mask, 0, 1 << 1)) return status::unimplemented;
+    jcp.is_oc_scale = oscale_mask == 1 << 1;
+
+    // F(4x4, 3x3) saves more multiplications, but its source transform does
+    // not fit 8 bits, so int8 is limited to F(2x2, 3x3). For small spatial
+    // sizes the larger tile is also wasted on padding.
+    auto transformed_size = [&](int m) {
+        return (dim_t)div_up(jcp.oh, m) * div_up(jcp.ow, m) * (m + 2)
+                * (m + 2);
+    };
+    jcp.m = !is_int8 && transformed_size(4) < transformed_size(2) ? 4 : 2;
+    jcp.alpha = jcp.m + 2;
+    jcp.tiles_h = div_up(jcp.oh, jcp.m);
+    jcp.tiles_w = div_up(jcp.ow, jcp.m);
+    jcp.ntiles = (dim_t)jcp.mb * jcp.tiles_h * jcp.tiles_w;
+
+    if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
+                is_winograd_faster_than_direct(jcp, is_int8)))
+        return status::unimplemented;
+
+    // Keep transformed source and destination of a block of tiles in L2 when
+    // possible, but do not let the GEMMs become too narrow.
+    const int aa = jcp.alpha * jcp.alpha;
+    const size_t typesize_src = is_int8 ? sizeof(uint8_t) : sizeof(float);
+    const size_t tile_bytes
+            = aa * (jcp.ic * typesize_src + jcp.oc * sizeof(float));
+    const size_t L2_size = platform::get_per_core_cache_size(2);
+    const int min_tile_block = 16, max_tile_block = 64;
+    jcp.tile_block = (int)nstl::min<size_t>(max_tile_block,
+            nstl::max<size_t>(min_tile_block, L2_size / tile_bytes));
+    jcp.tile_block = (int)nstl::max<dim_t>(1,
+            nstl::min<dim_t>(jcp.tile_block, div_up(jcp.ntiles, jcp.nthr)));
+    jcp.nb_tile_blocks = (int)div_up(jcp.ntiles, jcp.tile_block);
+
+    // Matrices of different points are shifted by a cache line to avoid
+    // cache set conflicts when their sizes are multiples of the page size.
+    auto get_p_stride = [](dim_t size, size_t typesize) {
+        const dim_t line = 64 / typesize;
+        return rnd_up(size, line) + line;
+    };
+    const size_t typesize_wei = is_int8 ? sizeof(int8_t) : sizeof(float);
+    jcp.U_p_stride = get_p_stride((dim_t)jcp.ic * jcp.oc, typesize_wei);
+    jcp.V_p_stride
+            = get_p_stride((dim_t)jcp.tile_block * jcp.ic, typesize_src);
+    jcp.M_p_stride
+            = get_p_stride((dim_t)jcp.tile_block * jcp.oc, sizeof(float));
+
+    const size_t U_size = rnd_up(aa * jcp.U_p_stride * typesize_wei, PAGE_4K);
+    const size_t comp_size = is_int8 ? aa * jcp.oc * sizeof(int32_t) : 0;
+    scratchpad.book<char>(key_wino_U, U_size + comp_size, PAGE_4K);
+    scratchpad.book<char>(key_wino_V,
+            (size_t)jcp.nthr * aa * jcp.V_p_stride * typesize_src, PAGE_4K);
+    scratchpad.book<char>(key_wino_M,
+            (size_t)jcp.nthr * aa * jcp.M_p_stride * sizeof(float), PAGE_4K);
+    scratchpad.book<float>(key_conv_padded_bias, jcp.oc);
+    scratchpad.book<float>(key_conv_adjusted_scales, jcp.oc);
+
+    return status::success;
+}
+
+} // namespace gemm_wino_convolution_utils
+
+template <data_type_t src_type, data_type_t dst_type>
+template <int m>
+status_t gemm_wino_convolution_fwd_t<src_type, dst_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    constexpr bool is_int8 = src_type == data_type::u8;
+    constexpr int alpha = wino_transform_t<m>::alpha;
+    constexpr int aa = alpha * alpha;
+
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &jcp = pd()->jcp_;
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    const size_t U_size
+            = rnd_up(aa * jcp.U_p_stride * sizeof(wei_data_t), PAGE_4K);
+    auto wino_wei = scratchpad.template get<wei_data_t>(key_wino_U);
+    auto comp = is_int8 ? reinterpret_cast<int32_t *>(
+                        scratchpad.template get<char>(key_wino_U) + U_size)
+                        : nullptr;
+    auto wino_src_base = scratchpad.template get<src_data_t>(key_wino_V);
+    auto wino_dst_base = scratchpad.template get<acc_data_t>(key_wino_M);
+
+    transform_weights<m>(jcp, wei_d, wei, wino_wei, comp);
+
+    // Bias and output scales are padded with zeros up to the channels
+    // blocking, zero scales keep padded channels of destination zero.
+    auto bias_v = scratchpad.template get<float>(key_conv_padded_bias);
+    auto scales_v = scratchpad.template get<float>(key_conv_adjusted_scales);
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+    for (int oc = 0; oc < jcp.oc; oc++) {
+        const bool is_padding = oc >= jcp.oc_without_padding;
+        bias_v[oc] = jcp.with_bias && !is_padding
+                ? io::load_float_value(jcp.bia_dt, bias, oc)
+                : 0.f;
+        scales_v[oc] = is_padding ? 0.f : oscales[jcp.is_oc_scale * oc];
+    }
+
+    const float wino_scale
+            = is_int8 ? 1.f / (adj_src_scale * adj_wei_scale) : 1.f;
+    const dim_t U_p_stride = jcp.U_p_stride;
+    const dim_t V_p_stride = jcp.V_p_stride;
+    const dim_t M_p_stride = jcp.M_p_stride;
+
+    std::atomic<status_t> st(status::success);
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(jcp.nb_tile_blocks, nthr, ithr, start, end);
+
+        src_data_t *wino_src = wino_src_base + ithr * aa * V_p_stride;
+        acc_data_t *wino_dst = wino_dst_base + ithr * aa * M_p_stride;
+        const src_data_t *src_pts[aa];
+        dst_data_t *dst_pts[m * m];
+
+        for (int tb = start; tb < end; tb++) {
+            const dim_t t_start = (dim_t)tb * jcp.tile_block;
+            const dim_t t_end = nstl::min(t_start + jcp.tile_block, jcp.ntiles);
+            const dim_t nt = t_end - t_start;
+
+            for (dim_t t = t_start; t < t_end; t++) {
+                const tile_t tile = get_tile(jcp, t);
+                get_tile_points(src_d, src, tile.n, tile.h - jcp.t_pad,
+                        tile.w - jcp.l_pad, alpha, src_pts);
+                for (int c = 0; c < jcp.ic; c += simd_w)
+                    transform_src_tile<m>(src_pts,
+                            chunk_off(src_d, jcp.is_nspc, c),
+                            nstl::min(simd_w, jcp.ic - c),
+                            wino_src + (t - t_start) * jcp.ic + c, V_p_stride);
+            }
+
+            const dim_t M = jcp.oc, N = nt, K = jcp.ic;
+            const float onef = 1.f, zerof = 0.f;
+            for (int p = 0; p < aa; p++) {
+                // Start threads at different points to spread the load of
+                // transformed weights.
+                const int pp = (p + ithr) % aa;
+                status_t st_thr;
+                if (is_int8) {
+                    const int8_t off_a = 0;
+                    const uint8_t off_b = 0;
+                    st_thr = gemm_s8x8s32("N", "N", "C", &M, &N, &K, &onef,
+                            (const int8_t *)wino_wei + pp * U_p_stride, &M,
+                            &off_a, (const uint8_t *)wino_src + pp * V_p_stride,
+                            &K, &off_b, &zerof,
+                            (int32_t *)wino_dst + pp * M_p_stride, &M,
+                            comp + pp * jcp.oc);
+                } else {
+                    st_thr = extended_sgemm("N", "N", &M, &N, &K, &onef,
+                            (const float *)wino_wei + pp * U_p_stride, &M,
+                            (const float *)wino_src + pp * V_p_stride, &K,
+                            &zerof, (float *)wino_dst + pp * M_p_stride, &M);
+                }
+                if (st_thr != status::success) {
+                    st = st_thr;
+                    return;
+                }
+            }
+
+            for (dim_t t = t_start; t < t_end; t++) {
+                const tile_t tile = get_tile(jcp, t);
+                get_tile_points(dst_d, dst, tile.n, tile.h, tile.w, m, dst_pts);
+                for (int c = 0; c < jcp.oc; c += simd_w)
+                    transform_dst_tile<m>(jcp, dst_pts,
+                            chunk_off(dst_d, jcp.is_nspc, c),
+                            nstl::min(simd_w, jcp.oc - c),
+                            wino_dst + (t - t_start) * jcp.oc + c, M_p_stride,
+                            wino_scale, bias_v + c, scales_v + c,
+                            eltwise_.get());
+            }
+        }
+    });
+    return st;
+}
+
+template struct gemm_wino_convolution_fwd_t<data_type::f32, data_type::f32>;
+template struct gemm_wino_convolution_fwd_t<data_type::u8, data_type::f32>;
+template struct gemm_wino_convolution_fwd_t<data_type::u8, data_type::s32>;
+template struct gemm_wino_convolution_fwd_t<data_type::u8, data_type::s8>;
+template struct gemm_wino_convolution_fwd_t<data_type::u8, data_type::u8>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
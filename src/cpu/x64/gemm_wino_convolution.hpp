@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_GEMM_WINO_CONVOLUTION_HPP
+#define CPU_X64_GEMM_WINO_CONVOLUTION_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd convolution F(m x m, 3 x 3) for AVX2 capable processors. Weights
+// are transformed at each execution and source tiles are transformed in
+// blocks right before the element-wise products in Winograd domain, which
+// are computed as alpha * alpha independent matrix multiplications by the
+// jit GEMM (sgemm or gemm_s8u8s32):
+//     M[p](oc, tile) = U[p](oc, ic) * V[p](ic, tile), p = 0 .. alpha^2 - 1
+// The int8 flavor uses the range-limiting trick of the AVX-512 version:
+// source is scaled down by 4 so that its transform fits 8 bits, and weights
+// are scaled by 4 / 9 after the transform to fit s8.
+struct gemm_wino_conf_t {
+    int nthr;
+    int mb, ic, oc, ic_without_padding, oc_without_padding;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+    int m, alpha; // output and input tile sizes
+    int tiles_h, tiles_w;
+    dim_t ntiles;
+    int tile_block, nb_tile_blocks; // tiles processed by a thread at once
+    dim_t U_p_stride, V_p_stride, M_p_stride; // distance between points
+    bool with_groups;
+    bool is_nspc; // nhwc data layout, nChw8c otherwise
+    bool with_bias, with_sum, with_eltwise, with_relu;
+    data_type_t bia_dt;
+    float sum_scale;
+    bool is_oc_scale;
+};
+
+namespace gemm_wino_convolution_utils {
+status_t init_conf(gemm_wino_conf_t &jcp,
+        memory_tracking::registrar_t &scratchpad, const convolution_desc_t &cd,
+        const memory_desc_t &src_md, const memory_desc_t &weights_md,
+        const memory_desc_t &dst_md, const memory_desc_t &bias_md,
+        const primitive_attr_t &attr, int max_threads);
+} // namespace gemm_wino_convolution_utils
+
+template <data_type_t src_type, data_type_t dst_type>
+struct gemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+
+        DECLARE_COMMON_PD_T(jcp_.m == 4
+                        ? JIT_IMPL_NAME_HELPER("gemm_wino_4x3:", avx2, "")
+                        : JIT_IMPL_NAME_HELPER("gemm_wino_2x3:", avx2, ""),
+                gemm_wino_convolution_fwd_t, USE_GLOBAL_SCRATCHPAD);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+            const bool is_int8 = src_type == u8;
+
+            bool ok = is_fwd() && mayiuse(avx2)
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(src_type, is_int8 ? s8 : f32, undef,
+                            dst_type, is_int8 ? s32 : f32)
+                    && IMPLICATION(with_bias(),
+                            is_int8 ? utils::one_of(
+                                    bias_md_.data_type, f32, s32, s8, u8)
+                                    : bias_md_.data_type == f32)
+                    && attr()->has_default_values(is_int8
+                                    ? smask_t::oscale | smask_t::post_ops
+                                    : smask_t::post_ops,
+                            dst_type)
+                    && !has_zero_dim_memory() && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            CHECK(gemm_wino_convolution_utils::init_conf(jcp_, scratchpad,
+                    *desc(), src_md_, weights_md_, dst_md_, bias_md_, *attr(),
+                    dnnl_get_max_threads()));
+            set_default_alg_kind(alg_kind::convolution_winograd);
+            return status::success;
+        }
+
+        gemm_wino_conf_t jcp_;
+
+    protected:
+        bool set_default_formats() {
+            using namespace format_tag;
+            // Follow the layout of the user if any was specified, otherwise
+            // pick the one used by direct implementations.
+            format_tag_t dat_tag = src_type == data_type::u8 ? nhwc : nChw8c;
+            for (const auto *md : {&src_md_, &dst_md_}) {
+                if (md->format_kind == format_kind::any) continue;
+                dat_tag = memory_desc_wrapper(md).matches_one_of_tag(
+                        nhwc, nChw8c);
+                break;
+            }
+            if (dat_tag == format_tag::undef) return false;
+            const format_tag_t wei_tag = dat_tag == nChw8c
+                    ? utils::pick(with_groups(), OIhw8i8o, gOIhw8i8o)
+                    : utils::pick(with_groups(), hwio, hwigo);
+            return set_default_formats_common(dat_tag, wei_tag, dat_tag);
+        }
+    };
+
+    gemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        const auto &jcp = pd()->jcp_;
+        if (jcp.with_eltwise) {
+            const auto &po = pd()->attr()->post_ops_;
+            const int eltwise_idx = po.find(primitive_kind::eltwise);
+            CHECK(safe_ptr_assign(eltwise_,
+                    new ref_eltwise_scalar_fwd_t(
+                            po.entry_[eltwise_idx].eltwise)));
+        }
+        return status::success;
+    }
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+    typedef typename utils::conditional<src_type == data_type::u8, int8_t,
+            float>::type wei_data_t;
+    typedef typename utils::conditional<src_type == data_type::u8, int32_t,
+            float>::type acc_data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return pd()->jcp_.m == 4 ? execute_forward<4>(ctx)
+                                 : execute_forward<2>(ctx);
+    }
+
+private:
+    template <int m>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_eltwise_scalar_fwd_t> eltwise_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
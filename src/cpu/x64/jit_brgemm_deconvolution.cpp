@@ -0,0 +1,471 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_deconvolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Collects kernel taps (and the corresponding input positions) which
+// contribute to output position `o` along one spatial dimension.
+int get_valid_taps(int o, int pad, int stride, int dilate, int k, int i_size,
+        int *k_list, int *i_list) {
+    int n = 0;
+    for (int ki = 0; ki < k; ki++) {
+        const int x = o + pad - ki * (dilate + 1);
+        if (x < 0 || x % stride != 0) continue;
+        const int i = x / stride;
+        if (i >= i_size) continue;
+        k_list[n] = ki;
+        i_list[n] = i;
+        n++;
+    }
+    return n;
+}
+
+dim_t data_blk_off(const memory_desc_wrapper &d, int ndims, int n, int c,
+        int id, int ih, int iw) {
+    switch (ndims) {
+        case 5: return d.blk_off(n, c, id, ih, iw);
+        case 4: return d.blk_off(n, c, ih, iw);
+        default: return d.blk_off(n, c, iw);
+    }
+}
+
+dim_t wei_blk_off(const memory_desc_wrapper &d, bool with_groups, int ndims,
+        int g, int ocb, int icb, int kd, int kh, int kw) {
+    switch (ndims) {
+        case 5:
+            return with_groups ? d.blk_off(g, ocb, icb, kd, kh, kw)
+                               : d.blk_off(ocb, icb, kd, kh, kw);
+        case 4:
+            return with_groups ? d.blk_off(g, ocb, icb, kh, kw)
+                               : d.blk_off(ocb, icb, kh, kw);
+        default:
+            return with_groups ? d.blk_off(g, ocb, icb, kw)
+                               : d.blk_off(ocb, icb, kw);
+    }
+}
+
+} // namespace
+
+namespace brgemm_deconvolution_utils {
+
+status_t init_conf(cpu_isa_t isa, jit_brgemm_deconv_conf_t &jcp,
+        const deconvolution_desc_t &dd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads) {
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+    const memory_desc_wrapper weights_d(&weights_md);
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+    const bool is_1d = ndims == 3;
+    const bool is_3d = ndims == 5;
+    const bool is_bf16 = isa == avx512_core_bf16;
+
+    jcp.nthr = nthreads;
+    jcp.ndims = ndims;
+    jcp.mb = src_d.dims()[0];
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.ic = jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
+    jcp.oc = jcp.oc_without_padding = dst_d.dims()[1] / jcp.ngroups;
+    jcp.id = is_3d ? src_d.dims()[2] : 1;
+    jcp.ih = is_1d ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = is_3d ? dst_d.dims()[2] : 1;
+    jcp.oh = is_1d ? 1 : dst_d.dims()[ndims - 2];
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kd = is_3d ? weights_d.dims()[with_groups + 2] : 1;
+    jcp.kh = is_1d ? 1 : weights_d.dims()[with_groups + ndims - 2];
+    jcp.kw = weights_d.dims()[with_groups + ndims - 1];
+    jcp.stride_d = is_3d ? dd.strides[0] : 1;
+    jcp.stride_h = is_1d ? 1 : dd.strides[ndims - 4];
+    jcp.stride_w = dd.strides[ndims - 3];
+    jcp.dilate_d = is_3d ? dd.dilates[0] : 0;
+    jcp.dilate_h = is_1d ? 0 : dd.dilates[ndims - 4];
+    jcp.dilate_w = dd.dilates[ndims - 3];
+    jcp.f_pad = is_3d ? dd.padding[0][0] : 0;
+    jcp.t_pad = is_1d ? 0 : dd.padding[0][ndims - 4];
+    jcp.l_pad = dd.padding[0][ndims - 3];
+
+    // Negative left padding would make the output phases depend on more
+    // than the output position; leave such shapes to the reference.
+    if (jcp.f_pad < 0 || jcp.t_pad < 0 || jcp.l_pad < 0)
+        return status::unimplemented;
+
+    const format_tag_t nspc_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const format_tag_t blk_tag = pick(ndims - 3, nCw16c, nChw16c, nCdhw16c);
+    format_tag_t dat_tag = nspc_tag;
+    if (src_d.format_kind() != format_kind::any)
+        dat_tag = src_d.matches_one_of_tag(nspc_tag, blk_tag);
+    else if (dst_d.format_kind() != format_kind::any)
+        dat_tag = dst_d.matches_one_of_tag(nspc_tag, blk_tag);
+    if (dat_tag == format_tag::undef) return status::unimplemented;
+
+    if (src_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md, dat_tag));
+    else if (!src_d.matches_tag(dat_tag))
+        return status::unimplemented;
+    if (dst_d.format_kind() == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md, dat_tag));
+    else if (!dst_d.matches_tag(dat_tag))
+        return status::unimplemented;
+    jcp.is_nspc = dat_tag == nspc_tag;
+
+    // Blocked layouts do not support padding between groups.
+    if (!jcp.is_nspc && jcp.ngroups > 1
+            && (jcp.ic % 16 != 0 || jcp.oc % 16 != 0))
+        return status::unimplemented;
+
+    // With nspc layout the whole ic is a single reduction block, otherwise
+    // every ic block is a separate batch element.
+    jcp.oc_block = 16;
+    jcp.nb_oc = div_up(jcp.oc, jcp.oc_block);
+    if (jcp.is_nspc) {
+        jcp.ic_block = jcp.ic;
+        jcp.nb_ic = 1;
+        jcp.oc_tail = jcp.oc % jcp.oc_block;
+    } else {
+        jcp.ic = rnd_up(jcp.ic, 16);
+        jcp.oc = rnd_up(jcp.oc, 16);
+        jcp.ic_block = 16;
+        jcp.nb_ic = jcp.ic / jcp.ic_block;
+        jcp.oc_tail = 0;
+    }
+
+    format_tag_t wei_tag;
+    if (jcp.is_nspc) {
+        wei_tag = is_bf16
+                ? (with_groups ? pick(ndims - 3, gOwI16o2i, gOhwI16o2i,
+                           gOdhwI16o2i)
+                               : pick(ndims - 3, OwI16o2i, OhwI16o2i,
+                                       OdhwI16o2i))
+                : (with_groups ? pick(ndims - 3, gOwi16o, gOhwi16o, gOdhwi16o)
+                               : pick(ndims - 3, Owi16o, Ohwi16o, Odhwi16o));
+    } else {
+        wei_tag = is_bf16
+                ? (with_groups ? pick(ndims - 3, gOIw8i16o2i, gOIhw8i16o2i,
+                           gOIdhw8i16o2i)
+                               : pick(ndims - 3, OIw8i16o2i, OIhw8i16o2i,
+                                       OIdhw8i16o2i))
+                : (with_groups ? pick(ndims - 3, gOIw16i16o, gOIhw16i16o,
+                           gOIdhw16i16o)
+                               : pick(ndims - 3, OIw16i16o, OIhw16i16o,
+                                       OIdhw16i16o));
+    }
+    memory_desc_t want_wei_md = weights_md;
+    CHECK(memory_desc_init_by_tag(want_wei_md, wei_tag));
+    if (weights_md.format_kind == format_kind::any)
+        weights_md = want_wei_md;
+    else if (weights_md != want_wei_md)
+        return status::unimplemented;
+
+    jcp.with_bias = dd.bias_desc.format_kind != format_kind::undef;
+    if (jcp.with_bias && bias_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md, x));
+    jcp.src_dt = src_d.data_type();
+    jcp.wei_dt = weights_d.data_type();
+    jcp.dst_dt = dst_d.data_type();
+    jcp.bia_dt = jcp.with_bias ? bias_md.data_type : data_type::undef;
+    jcp.use_padded_bias
+            = jcp.with_bias && jcp.oc != jcp.oc_without_padding;
+
+    const memory_desc_wrapper src_d_final(&src_md);
+    const memory_desc_wrapper dst_d_final(&dst_md);
+    jcp.LDA = (int)src_d_final.blocking_desc().strides[ndims - 1];
+    jcp.LDB = jcp.oc_block;
+    jcp.LDD = jcp.stride_w
+            * (int)dst_d_final.blocking_desc().strides[ndims - 1];
+
+    // Split each output row phase into segments with a constant set of
+    // valid kw taps.
+    jcp.taps.clear();
+    jcp.segments.clear();
+    jcp.M_values.clear();
+    jcp.has_empty_taps = false;
+    int max_seg_taps = 0;
+    const int nphases = nstl::min(jcp.stride_w, jcp.ow);
+    for (int r = 0; r < nphases; r++) {
+        const int len = div_up(jcp.ow - r, jcp.stride_w);
+        std::vector<int> kws, bases, points {0, len};
+        for (int kw = 0; kw < jcp.kw; kw++) {
+            const int x = r + jcp.l_pad - kw * (jcp.dilate_w + 1);
+            if (((x % jcp.stride_w) + jcp.stride_w) % jcp.stride_w != 0)
+                continue;
+            const int base = x / jcp.stride_w; // exact division
+            kws.push_back(kw);
+            bases.push_back(base);
+            points.push_back(saturate(0, len, -base));
+            points.push_back(saturate(0, len, jcp.iw - base));
+        }
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+
+        int prev_seg = -1;
+        for (size_t p = 0; p + 1 < points.size(); p++) {
+            const int t_beg = points[p], t_end = points[p + 1];
+            std::vector<int> seg_kws, seg_iws;
+            for (size_t i = 0; i < kws.size(); i++) {
+                if (bases[i] + t_beg < 0 || bases[i] + t_end > jcp.iw)
+                    continue;
+                seg_kws.push_back(kws[i]);
+                seg_iws.push_back(bases[i] + t_beg);
+            }
+            // Merge with the previous segment if taps are the same.
+            if (prev_seg >= 0) {
+                auto &prev = jcp.segments[prev_seg];
+                bool same = prev.ntaps == (int)seg_kws.size();
+                for (int i = 0; same && i < prev.ntaps; i++)
+                    same = jcp.taps[prev.tap_start + i].kw == seg_kws[i];
+                if (same) {
+                    prev.len += t_end - t_beg;
+                    continue;
+                }
+            }
+            jit_brgemm_deconv_conf_t::segment_t seg;
+            seg.ow = r + t_beg * jcp.stride_w;
+            seg.len = t_end - t_beg;
+            seg.m_idx = -1;
+            seg.tap_start = (int)jcp.taps.size();
+            seg.ntaps = (int)seg_kws.size();
+            for (size_t i = 0; i < seg_kws.size(); i++)
+                jcp.taps.push_back({seg_kws[i], seg_iws[i]});
+            jcp.segments.push_back(seg);
+            prev_seg = (int)jcp.segments.size() - 1;
+        }
+    }
+    for (auto &seg : jcp.segments) {
+        auto it = std::find(jcp.M_values.begin(), jcp.M_values.end(), seg.len);
+        seg.m_idx = (int)(it - jcp.M_values.begin());
+        if (it == jcp.M_values.end()) jcp.M_values.push_back(seg.len);
+        max_seg_taps = nstl::max(max_seg_taps, seg.ntaps);
+        if (seg.ntaps == 0) jcp.has_empty_taps = true;
+    }
+
+    std::vector<int> k_list(nstl::max(jcp.kd, jcp.kh)),
+            i_list(nstl::max(jcp.kd, jcp.kh));
+    int max_kd_taps = 0, max_kh_taps = 0;
+    for (int od = 0; od < jcp.od; od++) {
+        const int n = get_valid_taps(od, jcp.f_pad, jcp.stride_d,
+                jcp.dilate_d, jcp.kd, jcp.id, k_list.data(), i_list.data());
+        max_kd_taps = nstl::max(max_kd_taps, n);
+        if (n == 0) jcp.has_empty_taps = true;
+    }
+    for (int oh = 0; oh < jcp.oh; oh++) {
+        const int n = get_valid_taps(oh, jcp.t_pad, jcp.stride_h,
+                jcp.dilate_h, jcp.kh, jcp.ih, k_list.data(), i_list.data());
+        max_kh_taps = nstl::max(max_kh_taps, n);
+        if (n == 0) jcp.has_empty_taps = true;
+    }
+    jcp.max_batch = nstl::max(
+            1, max_kd_taps * max_kh_taps * max_seg_taps * jcp.nb_ic);
+
+    int num_kernels = 0;
+    for_(int i_oc = 0; i_oc < 2; i_oc++)
+    for (int i_empty = 0; i_empty < 2; i_empty++)
+        num_kernels += jcp.is_kernel_used(i_oc, i_empty);
+    num_kernels *= (int)jcp.M_values.size();
+    if (num_kernels > jit_brgemm_deconv_conf_t::max_num_kernels)
+        return status::unimplemented;
+
+    return status::success;
+}
+
+status_t init_brgemm_desc(cpu_isa_t isa, brgemm_t &brg,
+        const jit_brgemm_deconv_conf_t &jcp, const primitive_attr_t &attr,
+        int m_idx, bool is_oc_tail, bool is_empty) {
+    const int M = jcp.M_values[m_idx];
+    const int N = is_oc_tail ? jcp.oc_tail : jcp.oc_block;
+    const int K = jcp.ic_block;
+    // alpha == 0 makes the kernel skip the batch entirely.
+    const float alpha = is_empty ? 0.f : 1.f;
+    const float beta = 0.f;
+
+    CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, jcp.src_dt, jcp.wei_dt,
+            false, false, brgemm_row_major, alpha, beta, jcp.LDA, jcp.LDB,
+            jcp.LDD, M, N, K));
+    CHECK(brgemm_desc_set_postops(&brg, &attr, jcp.dst_dt, jcp.LDD,
+            jcp.with_bias ? jcp.bia_dt : data_type::undef));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = jcp.max_batch;
+    return brgemm_desc_set_attr(&brg, brgattr);
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_deconv_conf_t &jcp) {
+    scratchpad.book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, (size_t)jcp.nthr * jcp.max_batch);
+    if (jcp.use_padded_bias)
+        scratchpad.book(key_conv_padded_bias, jcp.ngroups * jcp.oc,
+                types::data_type_size(jcp.bia_dt));
+}
+
+} // namespace brgemm_deconvolution_utils
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+    brg_kernels_.resize(jcp.num_kernel_slots());
+    for_(int m_idx = 0; m_idx < (int)jcp.M_values.size(); m_idx++)
+    for_(int i_oc = 0; i_oc < 2; i_oc++)
+    for (int i_empty = 0; i_empty < 2; i_empty++) {
+        if (!jcp.is_kernel_used(i_oc, i_empty)) continue;
+        brgemm_t brg;
+        CHECK(brgemm_deconvolution_utils::init_brgemm_desc(
+                isa, brg, jcp, *pd()->attr(), m_idx, i_oc, i_empty));
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(
+                brg_kernels_[jcp.get_kernel_idx(m_idx, i_oc, i_empty)], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_deconvolution_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    const auto &jcp = pd()->jcp_;
+    const bool with_groups = pd()->with_groups();
+    const size_t src_dt_size = types::data_type_size(jcp.src_dt);
+    const size_t wei_dt_size = types::data_type_size(jcp.wei_dt);
+    const size_t dst_dt_size = types::data_type_size(jcp.dst_dt);
+    const size_t bia_dt_size
+            = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    if (jcp.use_padded_bias) {
+        auto padded_bias = scratchpad.template get<char>(key_conv_padded_bias);
+        const size_t oc_bytes = bia_dt_size * jcp.oc_without_padding;
+        for (int g = 0; g < jcp.ngroups; g++) {
+            char *pb = padded_bias + g * bia_dt_size * jcp.oc;
+            utils::array_copy(pb, bias + g * oc_bytes, oc_bytes);
+            utils::array_set(pb + oc_bytes, 0,
+                    bia_dt_size * (jcp.oc - jcp.oc_without_padding));
+        }
+        bias = padded_bias;
+    }
+    auto batch_global = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // Channel positions are passed to blk_off() in blocks for blocked
+    // layouts and in elements for nspc.
+    const int c_div = jcp.is_nspc ? 1 : 16;
+    const int work_amount
+            = jcp.mb * jcp.ngroups * jcp.nb_oc * jcp.od * jcp.oh;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch
+                = batch_global + (size_t)ithr * jcp.max_batch;
+        std::vector<int> kd_list(jcp.kd), id_list(jcp.kd);
+        std::vector<int> kh_list(jcp.kh), ih_list(jcp.kh);
+
+        int n {0}, g {0}, ocb {0}, od {0}, oh {0};
+        nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, od,
+                jcp.od, oh, jcp.oh);
+        for (int iwork = start; iwork < end; iwork++) {
+            const int nkd = get_valid_taps(od, jcp.f_pad, jcp.stride_d,
+                    jcp.dilate_d, jcp.kd, jcp.id, kd_list.data(),
+                    id_list.data());
+            const int nkh = get_valid_taps(oh, jcp.t_pad, jcp.stride_h,
+                    jcp.dilate_h, jcp.kh, jcp.ih, kh_list.data(),
+                    ih_list.data());
+
+            const bool is_oc_tail = jcp.oc_tail > 0 && ocb == jcp.nb_oc - 1;
+            const int oc = g * jcp.oc + ocb * jcp.oc_block;
+            const int ic = g * jcp.ic;
+            const char *ptr_bias
+                    = jcp.with_bias ? bias + bia_dt_size * oc : nullptr;
+
+            for (const auto &seg : jcp.segments) {
+                int bs = 0;
+                for_(int i_kd = 0; i_kd < nkd; i_kd++)
+                for_(int i_kh = 0; i_kh < nkh; i_kh++)
+                for_(int i_kw = 0; i_kw < seg.ntaps; i_kw++)
+                for (int icb = 0; icb < jcp.nb_ic; icb++) {
+                    const auto &tap = jcp.taps[seg.tap_start + i_kw];
+                    batch[bs].ptr.A = src
+                            + src_dt_size
+                                    * data_blk_off(src_d, jcp.ndims, n,
+                                            (ic + icb * jcp.ic_block) / c_div,
+                                            id_list[i_kd], ih_list[i_kh],
+                                            tap.iw);
+                    batch[bs].ptr.B = weights
+                            + wei_dt_size
+                                    * wei_blk_off(weights_d, with_groups,
+                                            jcp.ndims, g, ocb, icb,
+                                            kd_list[i_kd], kh_list[i_kh],
+                                            tap.kw);
+                    bs++;
+                }
+
+                const int ker_idx
+                        = jcp.get_kernel_idx(seg.m_idx, is_oc_tail, bs == 0);
+                char *ptr_D = dst
+                        + dst_dt_size
+                                * data_blk_off(dst_d, jcp.ndims, n, oc / c_div,
+                                        od, oh, seg.ow);
+                brgemm_kernel_execute_postops(brg_kernels_[ker_idx].get(), bs,
+                        batch, ptr_D, ptr_D, ptr_bias, nullptr);
+            }
+
+            nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, od,
+                    jcp.od, oh, jcp.oh);
+        }
+    });
+}
+
+template struct brgemm_deconvolution_fwd_t<avx512_core>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
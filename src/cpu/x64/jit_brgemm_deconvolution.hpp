@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_DECONVOLUTION_HPP
+#define CPU_X64_JIT_BRGEMM_DECONVOLUTION_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Forward deconvolution with stride s is computed as s^ndims dense
+// sub-convolutions: outputs of the same phase (ow % stride_w == r) are hit
+// by the same subset of kernel taps, and consecutive outputs of a phase read
+// consecutive input pixels. An output row of a phase is split into segments
+// with a constant set of valid kw taps, and each segment is a single brgemm
+// call with M = segment length, N = oc_block and the batch running over
+// valid (kd, kh, kw) taps and input channel blocks. Inserted zeros are never
+// touched, and bias and post-ops are applied by the brgemm epilogue.
+struct jit_brgemm_deconv_conf_t {
+    // Maximal number of distinct kernels generated for one primitive.
+    static constexpr int max_num_kernels = 64;
+
+    struct tap_t {
+        int kw; // kernel tap
+        int iw; // input column of the first segment point
+    };
+
+    struct segment_t {
+        int ow; // first output column
+        int len; // number of output points (stride_w apart)
+        int m_idx; // index of len in M_values
+        int tap_start, ntaps; // range in taps
+    };
+
+    int nthr;
+    int ndims, mb, ngroups;
+    int ic, oc, ic_without_padding, oc_without_padding;
+    int id, ih, iw, od, oh, ow;
+    int kd, kh, kw;
+    int stride_d, stride_h, stride_w;
+    int dilate_d, dilate_h, dilate_w; // 0 means dense kernel
+    int f_pad, t_pad, l_pad;
+    bool is_nspc; // nwc/nhwc/ndhwc data, nCw16c/nChw16c/nCdhw16c otherwise
+    int ic_block, nb_ic, oc_block, nb_oc, oc_tail;
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt;
+    bool with_bias, use_padded_bias;
+    bool has_empty_taps; // some outputs get no contribution from src
+    int LDA, LDB, LDD;
+    int max_batch;
+
+    std::vector<tap_t> taps;
+    std::vector<segment_t> segments;
+    std::vector<int> M_values;
+
+    int num_kernel_slots() const { return 4 * (int)M_values.size(); }
+    int get_kernel_idx(int m_idx, bool is_oc_tail, bool is_empty) const {
+        return (m_idx * 2 + (int)is_oc_tail) * 2 + (int)is_empty;
+    }
+    bool is_kernel_used(bool is_oc_tail, bool is_empty) const {
+        return IMPLICATION(is_oc_tail, oc_tail > 0)
+                && IMPLICATION(is_empty, has_empty_taps);
+    }
+};
+
+namespace brgemm_deconvolution_utils {
+status_t init_conf(cpu_isa_t isa, jit_brgemm_deconv_conf_t &jcp,
+        const deconvolution_desc_t &dd, memory_desc_t &src_md,
+        memory_desc_t &weights_md, memory_desc_t &dst_md,
+        memory_desc_t &bias_md, const primitive_attr_t &attr, int nthreads);
+
+// Kernels with is_empty set skip the batch and only apply the epilogue: they
+// compute outputs which no input pixel contributes to.
+status_t init_brgemm_desc(cpu_isa_t isa, brgemm_t &brg,
+        const jit_brgemm_deconv_conf_t &jcp, const primitive_attr_t &attr,
+        int m_idx, bool is_oc_tail, bool is_empty);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_deconv_conf_t &jcp);
+} // namespace brgemm_deconvolution_utils
+
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        pd_t(const deconvolution_desc_t *adesc, const primitive_attr_t *attr,
+                const deconvolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_deconvolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_deconv:", isa, ""),
+                brgemm_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            const data_type_t dt = isa == avx512_core_bf16 ? bf16 : f32;
+            const data_type_t dst_dt = dst_md_.data_type;
+            const bool ok = is_fwd() && mayiuse(isa)
+                    && desc()->alg_kind == alg_kind::deconvolution_direct
+                    && src_md_.data_type == dt && weights_md_.data_type == dt
+                    && IMPLICATION(dt == f32, dst_dt == f32)
+                    && IMPLICATION(dt == bf16, utils::one_of(dst_dt, f32, bf16))
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(bias_md_.data_type, f32, dt))
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops, dst_dt)
+                    && post_ops_ok() && !has_zero_dim_memory();
+            if (!ok) return status::unimplemented;
+
+            CHECK(brgemm_deconvolution_utils::init_conf(isa, jcp_, *desc(),
+                    src_md_, weights_md_, dst_md_, bias_md_, *attr(),
+                    dnnl_get_max_threads()));
+
+            // Kernels are generated by the primitive, but all of them are
+            // validated here, so that the primitive creation cannot fail.
+            for_(int m_idx = 0; m_idx < (int)jcp_.M_values.size(); m_idx++)
+            for_(int i_oc = 0; i_oc < 2; i_oc++)
+            for (int i_empty = 0; i_empty < 2; i_empty++) {
+                if (!jcp_.is_kernel_used(i_oc, i_empty)) continue;
+                brgemm_t brg;
+                CHECK(brgemm_deconvolution_utils::init_brgemm_desc(
+                        isa, brg, jcp_, *attr(), m_idx, i_oc, i_empty));
+            }
+
+            auto scratchpad = scratchpad_registry().registrar();
+            brgemm_deconvolution_utils::init_scratchpad(scratchpad, jcp_);
+            return status::success;
+        }
+
+        jit_brgemm_deconv_conf_t jcp_;
+
+    private:
+        bool post_ops_ok() const {
+            // Only what the brgemm epilogue supports: at most one sum and
+            // one eltwise in any order.
+            const auto &p = attr()->post_ops_;
+            if (p.len() > 2) return false;
+            int n_sum = 0, n_eltwise = 0;
+            for (int i = 0; i < p.len(); i++) {
+                if (p.entry_[i].is_sum(false))
+                    n_sum++;
+                else if (p.entry_[i].is_eltwise())
+                    n_eltwise++;
+                else
+                    return false;
+            }
+            return n_sum <= 1 && n_eltwise <= 1;
+        }
+    };
+
+    brgemm_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -698,10 +698,22 @@ struct jit_resampling_conf_t {
     unsigned number_of_corners = 0;
 
     bool is_data_size_bigger_than_L3 = false;
-    data_type_t data_type = data_type::undef;
-    size_t dt_size = 0;
+    data_type_t src_data_type = data_type::undef;
+    data_type_t dst_data_type = data_type::undef;
+    size_t src_dt_size = 0;
+    size_t dst_dt_size = 0;
     size_t el_size_of_indices = 0;
 
+    // Output scale is folded into the interpolation weights for the linear
+    // algorithm, so the kernel applies it for the nearest one only.
+    float output_scale = 1.f;
+    bool with_scales = false;
+
+    post_ops_t post_ops;
+    bool with_postops = false;
+    bool with_eltwise = false;
+    bool with_binary = false;
+
     jit_memory_tag_kind_t tag_kind = jit_memory_tag_kind_t::undef;
     alg_kind_t alg = alg_kind::undef;
 
@@ -725,6 +737,11 @@ struct jit_resampling_call_s {
     float weight_bottom = 0.0f;
     float weight_front = 0.0f;
     float weight_back = 0.0f;
+
+    // Logical index of the first channel processed by the kernel,
+    // used for the per channel broadcast of binary post-ops.
+    size_t c_offset = 0;
+    const void *post_ops_binary_rhs_arg_vec = nullptr;
 };
 
 } // namespace x64
@@ -0,0 +1,586 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+using namespace memory_tracking::names;
+
+#define GET_OFF(field) offsetof(jit_concat_call_s, field)
+
+template <cpu_isa_t isa>
+jit_uni_concat_kernel_t<isa>::jit_uni_concat_kernel_t(
+        data_type_t src_dt, data_type_t dst_dt)
+    : src_dt_(src_dt)
+    , dst_dt_(dst_dt)
+    , src_dt_size_(types::data_type_size(src_dt))
+    , dst_dt_size_(types::data_type_size(dst_dt)) {
+    if (dst_dt_ == bf16 && !mayiuse(avx512_core_bf16))
+        bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
+                bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                bf16_emu_reserv_4));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::load_vector(
+        const Vmm &vmm, const Address &addr) {
+    switch (src_dt_) {
+        case f32: uni_vmovups(vmm, addr); break;
+        case bf16:
+            vpmovzxwd(vmm, addr);
+            uni_vpslld(vmm, vmm, 16);
+            break;
+        case s8:
+            uni_vpmovsxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        case u8:
+            uni_vpmovzxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::load_scalar(
+        const Vmm &vmm, const Reg64 &reg_addr) {
+    const Xmm xmm(vmm.getIdx());
+    const Reg32 reg_tmp_32 = reg_tmp.cvt32();
+    switch (src_dt_) {
+        case f32: uni_vmovss(xmm, ptr[reg_addr]); break;
+        case bf16:
+            movzx(reg_tmp_32, word[reg_addr]);
+            shl(reg_tmp_32, 16);
+            vmovd(xmm, reg_tmp_32);
+            break;
+        case s8:
+        case u8:
+            if (src_dt_ == s8)
+                movsx(reg_tmp_32, byte[reg_addr]);
+            else
+                movzx(reg_tmp_32, byte[reg_addr]);
+            vmovd(xmm, reg_tmp_32);
+            uni_vcvtdq2ps(xmm, xmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::compute(const Vmm &vmm) {
+    uni_vmulps(vmm, vmm, vmm_scale);
+    if (is_int8_dst()) {
+        uni_vaddps(vmm, vmm, vmm_zero_point);
+        saturate_f32(vmm, vmm_lbound, vmm_ubound, dst_dt_);
+        uni_vcvtps2dq(vmm, vmm);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::cvt_to_bf16(const Ymm &ymm, const Vmm &vmm) {
+    const Zmm zmm(vmm.getIdx());
+    if (bf16_emu_)
+        bf16_emu_->vcvtneps2bf16(ymm, zmm);
+    else
+        vcvtneps2bf16(ymm, zmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::store_vector(
+        const Address &addr, const Vmm &vmm, bool use_nt_store) {
+    const Xmm xmm(vmm.getIdx());
+    const Ymm ymm(vmm.getIdx());
+    switch (dst_dt_) {
+        case f32:
+            if (use_nt_store)
+                uni_vmovntps(addr, vmm);
+            else
+                uni_vmovups(addr, vmm);
+            break;
+        case bf16:
+            assert(isa == avx512_core);
+            cvt_to_bf16(ymm, vmm);
+            if (use_nt_store)
+                vmovntdq(addr, ymm);
+            else
+                vmovdqu16(addr, ymm);
+            break;
+        case s8:
+        case u8:
+            if (isa == avx512_core) {
+                if (dst_dt_ == s8)
+                    vpmovsdb(xmm, vmm);
+                else
+                    vpmovusdb(xmm, vmm);
+                if (use_nt_store)
+                    vmovntdq(addr, xmm);
+                else
+                    vmovdqu(addr, xmm);
+            } else {
+                // s32 -> s16 = {qw0, 0, qw1, 0}
+                vpackssdw(vmm, vmm, vmm_zero);
+                // permute to restore order {qw0, 0, qw1, 0} -> {qw0, qw1, 0, 0}
+                vpermq(ymm, ymm, 0x58);
+                // s16 -> s8/u8 : {16 x s16}{16 x 0} -> {32 x s8/u8}
+                if (dst_dt_ == s8)
+                    vpacksswb(vmm, vmm, vmm_zero);
+                else
+                    vpackuswb(vmm, vmm, vmm_zero);
+                if (use_nt_store) {
+                    vmovq(reg_tmp, xmm);
+                    movnti(addr, reg_tmp);
+                } else
+                    vmovq(addr, xmm);
+            }
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::store_scalar(
+        const Reg64 &reg_addr, const Vmm &vmm) {
+    const Xmm xmm(vmm.getIdx());
+    const Ymm ymm(vmm.getIdx());
+    switch (dst_dt_) {
+        case f32: uni_vmovss(ptr[reg_addr], xmm); break;
+        case bf16:
+            cvt_to_bf16(ymm, vmm);
+            vmovd(reg_tmp.cvt32(), xmm);
+            mov(word[reg_addr], reg_tmp.cvt16());
+            break;
+        case s8:
+        case u8:
+            vpackssdw(xmm, xmm, xmm);
+            if (dst_dt_ == s8)
+                vpacksswb(xmm, xmm, xmm);
+            else
+                vpackuswb(xmm, xmm, xmm);
+            vmovd(reg_tmp.cvt32(), xmm);
+            mov(byte[reg_addr], reg_tmp.cvt8());
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::vector_loop(bool use_nt_store) {
+    Label unroll_loop, vector_loop, loop_end;
+
+    L(unroll_loop);
+    {
+        cmp(reg_nelems, unroll * simd_w);
+        jl(vector_loop, T_NEAR);
+        for (int u = 0; u < unroll; ++u)
+            load_vector(Vmm(u), ptr[reg_src + u * simd_w * src_dt_size_]);
+        for (int u = 0; u < unroll; ++u)
+            compute(Vmm(u));
+        for (int u = 0; u < unroll; ++u)
+            store_vector(ptr[reg_dst + u * simd_w * dst_dt_size_], Vmm(u),
+                    use_nt_store);
+        add(reg_src, unroll * simd_w * src_dt_size_);
+        add(reg_dst, unroll * simd_w * dst_dt_size_);
+        sub(reg_nelems, unroll * simd_w);
+        jmp(unroll_loop, T_NEAR);
+    }
+
+    L(vector_loop);
+    {
+        cmp(reg_nelems, simd_w);
+        jl(loop_end, T_NEAR);
+        load_vector(Vmm(0), ptr[reg_src]);
+        compute(Vmm(0));
+        store_vector(ptr[reg_dst], Vmm(0), use_nt_store);
+        add(reg_src, simd_w * src_dt_size_);
+        add(reg_dst, simd_w * dst_dt_size_);
+        sub(reg_nelems, simd_w);
+        jmp(vector_loop, T_NEAR);
+    }
+
+    L(loop_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::scalar_loop() {
+    Label scalar_loop, loop_end;
+
+    L(scalar_loop);
+    {
+        cmp(reg_nelems, 0);
+        jle(loop_end, T_NEAR);
+        load_scalar(Vmm(0), reg_src);
+        compute(Vmm(0));
+        store_scalar(reg_dst, Vmm(0));
+        add(reg_src, src_dt_size_);
+        add(reg_dst, dst_dt_size_);
+        dec(reg_nelems);
+        jmp(scalar_loop, T_NEAR);
+    }
+
+    L(loop_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_nelems, ptr[reg_param + GET_OFF(nelems)]);
+    mov(reg_nt, ptr[reg_param + GET_OFF(use_nt_store)]);
+
+    mov(reg_tmp, ptr[reg_param + GET_OFF(scale)]);
+    uni_vbroadcastss(vmm_scale, ptr[reg_tmp]);
+    if (is_int8_dst()) {
+        mov(reg_tmp, ptr[reg_param + GET_OFF(zero_point)]);
+        uni_vbroadcastss(vmm_zero_point, ptr[reg_tmp]);
+        init_saturate_f32(vmm_lbound, vmm_ubound, reg_tmp, f32, dst_dt_);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+    }
+    if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+    Label nt_store, tail, end;
+
+    cmp(reg_nt, 0);
+    jne(nt_store, T_NEAR);
+    vector_loop(false);
+    jmp(tail, T_NEAR);
+
+    L(nt_store);
+    vector_loop(true);
+
+    L(tail);
+    scalar_loop();
+
+    cmp(reg_nt, 0);
+    je(end, T_NEAR);
+    sfence();
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    bool ok = mayiuse(isa)
+            && cpu_concat_pd_t::init(nullptr, sm::scales | sm::zero_points)
+                    == status::success
+            && attr_zero_points_ok();
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper dst_d(dst_md());
+    const data_type_t dst_dt = dst_d.data_type();
+    ok = dst_d.ndims() <= 6 && utils::one_of(dst_dt, f32, bf16, s8, u8)
+            && IMPLICATION(dst_dt == bf16, isa == avx512_core)
+            && IMPLICATION(!utils::one_of(dst_dt, s8, u8),
+                    dst_zero_point_ == 0.f);
+    if (!ok) return status::unimplemented;
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        const memory_desc_wrapper o_d(&src_image_mds_[i]);
+
+        const bool ignore_strides = true;
+
+        ok = utils::one_of(i_d.data_type(), f32, bf16, s8, u8)
+                && utils::everyone_is(format_kind::blocked, i_d.format_kind(),
+                        o_d.format_kind())
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *o_d.md_, ignore_strides)
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *dst_d.md_, ignore_strides)
+                && !i_d.is_additional_buffer();
+        if (!ok) return status::unimplemented;
+    }
+
+    dst_d.compute_blocks(blocks_);
+    format_perm();
+
+    // start dim is the first dimension after which the concatenation
+    // would happen contiguously
+    const int start_dim = perm_[concat_dim()];
+
+    // check that contiguous part is indeed contiguous (i.e. dense)
+    if (nelems_to_concat(dst_d)
+            != dst_d.padded_dims()[concat_dim()] / blocks_[concat_dim()]
+                    * dst_d.blocking_desc().strides[concat_dim()])
+        return status::unimplemented;
+
+    // check that all inputs have the same strides for the
+    // contiguous part [concat_dim .. ndims] for the *major* dims.
+    // the block part is already checked above
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        for (int d = start_dim; d < dst_d.ndims(); ++d) {
+            if (dst_d.blocking_desc().strides[iperm_[d]]
+                    != i_d.blocking_desc().strides[iperm_[d]])
+                return status::unimplemented;
+        }
+    }
+
+    const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    use_nt_store_ = dst_d.size() > llc_size;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool jit_uni_concat_t<isa>::pd_t::attr_zero_points_ok() {
+    const auto &zp = attr()->zero_points_;
+    const bool ok = zp.has_default_values(DNNL_ARG_SRC)
+            && zp.has_default_values(DNNL_ARG_WEIGHTS)
+            && zp.defined(DNNL_ARG_DST) && zp.common(DNNL_ARG_DST);
+    if (!ok) return false;
+
+    dst_zero_point_ = (float)*zp.get(DNNL_ARG_DST);
+    return true;
+}
+
+template <cpu_isa_t isa>
+dim_t jit_uni_concat_t<isa>::pd_t::nelems_to_concat(
+        const memory_desc_wrapper &data_d) const {
+    const int ndims = data_d.ndims();
+
+    dim_t nelems = 1;
+    for (int i = perm_[concat_dim()]; i < ndims; i++)
+        nelems *= data_d.padded_dims()[iperm_[i]] / blocks_[iperm_[i]];
+    for (int i = 0; i < ndims; i++)
+        nelems *= blocks_[i];
+
+    return nelems;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_t<isa>::pd_t::format_perm() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+
+    strides_t strides = {0};
+    utils::array_copy(strides, dst_d.blocking_desc().strides, ndims);
+
+    dims_t ou_blocks = {0};
+    utils::array_copy(ou_blocks, dst_d.padded_dims(), ndims);
+
+    for (int d = 0; d < ndims; d++) {
+        iperm_[d] = d;
+        ou_blocks[d] /= blocks_[d];
+    }
+
+    utils::simultaneous_sort(strides, ou_blocks, iperm_, ndims,
+            [](stride_t a, stride_t b) { return b - a; });
+
+    for (int i = 0; i < ndims; i++)
+        perm_[iperm_[i]] = i;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const char *>(key_concat_iptrs, n_inputs());
+    scratchpad.template book<char *>(key_concat_optrs, n_inputs());
+    scratchpad.template book<dim_t>(key_concat_nelems, n_inputs());
+    scratchpad.template book<strides_t>(key_concat_istrides, n_inputs());
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::init(engine_t *engine) {
+    const int n = pd()->n_inputs();
+    kernel_idx_.resize(n);
+    for (int a = 0; a < n; ++a) {
+        const data_type_t src_dt = pd()->src_md(a)->data_type;
+        int k = 0;
+        while (k < (int)kernels_.size() && kernels_[k]->src_dt() != src_dt)
+            ++k;
+        if (k == (int)kernels_.size()) {
+            kernels_.emplace_back(
+                    new kernel_t(src_dt, pd()->dst_md()->data_type));
+            CHECK(kernels_.back()->create_kernel());
+        }
+        kernel_idx_[a] = k;
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_concat_t<isa>::execute_chunk(const kernel_t *kernel,
+        const char *src, char *dst, dim_t nelems, const float *scale,
+        bool use_nt_store) const {
+    // non-temporal stores pay off only if they write whole cache lines
+    const size_t nt_store_min_size = 16 * platform::get_cache_line_size();
+
+    const size_t src_dt_size = types::data_type_size(kernel->src_dt());
+    const size_t dst_dt_size
+            = types::data_type_size(pd()->dst_md()->data_type);
+
+    jit_concat_call_s p;
+    p.scale = scale;
+    p.zero_point = &pd()->dst_zero_point_;
+
+    if (use_nt_store && nelems * dst_dt_size >= nt_store_min_size) {
+        // process the unaligned head with regular stores
+        const size_t align
+                = kernel_t::store_size(pd()->dst_md()->data_type);
+        const size_t misalign = (size_t)dst % align;
+        const dim_t head = misalign == 0
+                ? 0
+                : nstl::min(nelems, (dim_t)((align - misalign) / dst_dt_size));
+        if (head > 0) {
+            p.src = src;
+            p.dst = dst;
+            p.nelems = head;
+            p.use_nt_store = 0;
+            (*kernel)(&p);
+        }
+        src += head * src_dt_size;
+        dst += head * dst_dt_size;
+        nelems -= head;
+    } else
+        use_nt_store = false;
+
+    p.src = src;
+    p.dst = dst;
+    p.nelems = nelems;
+    p.use_nt_store = use_nt_store;
+    (*kernel)(&p);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_concat_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto iptrs = scratchpad.template get<const char *>(key_concat_iptrs);
+    auto optrs = scratchpad.template get<char *>(key_concat_optrs);
+    auto nelems_to_copy = scratchpad.template get<dim_t>(key_concat_nelems);
+    auto is = scratchpad.template get<strides_t>(key_concat_istrides);
+
+    const int num_arrs = pd()->n_inputs();
+    const int *perm = pd()->perm_, *iperm = pd()->iperm_;
+    const int concat_dim = pd()->concat_dim();
+    const bool use_nt_store = pd()->use_nt_store_;
+    auto o_base_ptr = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper o_d(pd()->dst_md(0));
+    const size_t dst_dt_size = o_d.data_type_size();
+
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        const memory_desc_wrapper o_img_d(pd()->src_image_md(a));
+
+        iptrs[a] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0) * i_d.data_type_size();
+        optrs[a] = o_base_ptr + o_img_d.blk_off(0) * dst_dt_size;
+        nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
+        for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+            if (i < perm[concat_dim])
+                is[a][i] = size_t(i_d.blocking_desc().strides[iperm[i]]);
+            else
+                is[a][i] = 0;
+        }
+    }
+
+    auto scale = [&](int a) {
+        return &pd()->attr()->scales_.get(DNNL_ARG_MULTIPLE_SRC + a).scales_[0];
+    };
+    auto kernel = [&](int a) { return kernels_[kernel_idx_[a]].get(); };
+
+    strides_t os = {0};
+    bool has_outer_loop = false;
+    for (int i = 0; i < perm[concat_dim]; i++) {
+        os[i] = o_d.blocking_desc().strides[iperm[i]];
+        if (o_d.padded_dims()[iperm[i]] != 1) has_outer_loop = true;
+    }
+
+    // Applies when concat axis is the outermost dimension, e.g. concat_axis = 0
+    // or concat_axis = 1, and dims[0] = 1;
+    if (!has_outer_loop) {
+        // split every input into blocks of cache line size elements, so that
+        // the threads do not share the lines of the destination
+        const dim_t blk = platform::get_cache_line_size();
+        for (int a = 0; a < num_arrs; ++a) {
+            const size_t src_dt_size = types::data_type_size(
+                    pd()->src_md(a)->data_type);
+            const dim_t nblks = utils::div_up(nelems_to_copy[a], blk);
+            parallel(0, [&](const int ithr, const int nthr) {
+                dim_t start {0}, end {0};
+                balance211(nblks, nthr, ithr, start, end);
+                start *= blk;
+                end = nstl::min(end * blk, nelems_to_copy[a]);
+                if (start >= end) return;
+                execute_chunk(kernel(a), iptrs[a] + start * src_dt_size,
+                        optrs[a] + start * dst_dt_size, end - start, scale(a),
+                        use_nt_store);
+            });
+        }
+        return status::success;
+    }
+
+    dims_t phys_dims;
+    for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
+        if (i < perm[concat_dim])
+            phys_dims[i]
+                    = o_d.padded_dims()[iperm[i]] / pd()->blocks_[iperm[i]];
+        else
+            phys_dims[i] = 1;
+    }
+
+    parallel_nd(phys_dims[0], phys_dims[1], phys_dims[2], phys_dims[3],
+            phys_dims[4], num_arrs,
+            [&](dim_t n0, dim_t n1, dim_t n2, dim_t n3, dim_t n4, int a) {
+                const size_t in_off = is[a][0] * n0 + is[a][1] * n1
+                        + is[a][2] * n2 + is[a][3] * n3 + is[a][4] * n4;
+                const size_t out_off = os[0] * n0 + os[1] * n1 + os[2] * n2
+                        + os[3] * n3 + os[4] * n4;
+                const size_t src_dt_size = types::data_type_size(
+                        pd()->src_md(a)->data_type);
+                execute_chunk(kernel(a), iptrs[a] + in_off * src_dt_size,
+                        optrs[a] + out_off * dst_dt_size, nelems_to_copy[a],
+                        scale(a), use_nt_store);
+            });
+
+    return status::success;
+}
+
+template struct jit_uni_concat_kernel_t<avx2>;
+template struct jit_uni_concat_kernel_t<avx512_core>;
+template struct jit_uni_concat_t<avx2>;
+template struct jit_uni_concat_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_concat_call_s {
+    const void *src;
+    void *dst;
+    const float *scale;
+    const float *zero_point;
+    size_t nelems;
+    size_t use_nt_store;
+};
+
+/* Converts a contiguous chunk of one input to the destination data type:
+ *     dst[e] = saturate(scale * src[e] + zero_point), e < nelems
+ * The computations are done in f32. If use_nt_store is set, full vectors are
+ * written with non-temporal stores, in this case dst must be aligned on the
+ * vector store size (see store_size()). */
+template <cpu_isa_t isa>
+struct jit_uni_concat_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_kernel_t)
+
+    jit_uni_concat_kernel_t(data_type_t src_dt, data_type_t dst_dt);
+    ~jit_uni_concat_kernel_t() = default;
+
+    data_type_t src_dt() const { return src_dt_; }
+    // number of bytes written by a single full vector store
+    static size_t store_size(data_type_t dst_dt) {
+        return simd_w * types::data_type_size(dst_dt);
+    }
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using Xmm = Xbyak::Xmm;
+    using Ymm = Xbyak::Ymm;
+    using Zmm = Xbyak::Zmm;
+    using Reg64 = Xbyak::Reg64;
+
+    static constexpr int unroll = 4;
+
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const size_t src_dt_size_;
+    const size_t dst_dt_size_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_nelems = r10;
+    const Reg64 reg_nt = r11;
+    const Reg64 reg_tmp = rax;
+    const Reg64 bf16_emu_scratch = r12;
+
+    // vector registers [0, unroll) hold the data
+    const Vmm vmm_scale = Vmm(unroll);
+    const Vmm vmm_zero_point = Vmm(unroll + 1);
+    const Vmm vmm_lbound = Vmm(unroll + 2);
+    const Vmm vmm_ubound = Vmm(unroll + 3);
+    const Vmm vmm_zero = Vmm(unroll + 4);
+
+    const Zmm bf16_emu_reserv_1 = Zmm(26);
+    const Zmm bf16_emu_reserv_2 = Zmm(27);
+    const Zmm bf16_emu_reserv_3 = Zmm(28);
+    const Zmm bf16_emu_reserv_4 = Zmm(29);
+
+    bool is_int8_dst() const {
+        return utils::one_of(dst_dt_, data_type::s8, data_type::u8);
+    }
+
+    void load_vector(const Vmm &vmm, const Xbyak::Address &addr);
+    void load_scalar(const Vmm &vmm, const Reg64 &reg_addr);
+    void compute(const Vmm &vmm);
+    void store_vector(
+            const Xbyak::Address &addr, const Vmm &vmm, bool use_nt_store);
+    void store_scalar(const Reg64 &reg_addr, const Vmm &vmm);
+    void cvt_to_bf16(const Ymm &ymm, const Vmm &vmm);
+
+    void vector_loop(bool use_nt_store);
+    void scalar_loop();
+
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        int perm_[DNNL_MAX_NDIMS] {};
+        int iperm_[DNNL_MAX_NDIMS] {};
+        dims_t blocks_ {};
+        float dst_zero_point_ = 0.f;
+        // the destination does not fit into the LLC, so writing it through
+        // the caches only evicts the inputs
+        bool use_nt_store_ = false;
+
+        dim_t nelems_to_concat(const memory_desc_wrapper &data_d) const;
+
+    private:
+        bool attr_zero_points_ok();
+        void format_perm();
+        void init_scratchpad();
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    using kernel_t = jit_uni_concat_kernel_t<isa>;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void execute_chunk(const kernel_t *kernel, const char *src, char *dst,
+            dim_t nelems, const float *scale, bool use_nt_store) const;
+
+    // one kernel per distinct source data type
+    std::vector<std::unique_ptr<kernel_t>> kernels_;
+    std::vector<int> kernel_idx_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -641,7 +641,15 @@ void jit_uni_i8i8_pooling_fwd_ker_t<sse41>::store_dst_avg_op(
 
     const Vmm &vr_dst = vreg_dst_s32(jj, ll);
 
-    if (jpp.src_dt == s32) {
+    if (jpp.dst_dt == f32) {
+        const Vmm &vr_dst_f32 = vreg_dst_f32(jj, ll);
+        if (masked)
+            for (int i = 0; i < math::ilog2q(msk + 1); i++)
+                pextrd(ptr[reg_ptr_dst_i8 + offset + i * data_type_size(f32)],
+                        vr_dst_f32, i);
+        else
+            movups(ptr[reg_ptr_dst_i8 + offset], vr_dst_f32);
+    } else if (jpp.src_dt == s32) {
         if (masked)
             for (int i = 0; i < jpp.c_tail; i++)
                 pextrd(ptr[reg_ptr_dst_i8 + offset + i * data_type_size(s32)],
@@ -760,6 +768,23 @@ void jit_uni_i8i8_pooling_fwd_ker_t<avx2>::store_dst_avg_op(
             break;
         case s8: store_i8(true, masked, vreg_dst_s32(jj, ll)); break;
         case u8: store_i8(false, masked, vreg_dst_s32(jj, ll)); break;
+        case f32:
+            if (masked) {
+                // vreg_mask is a byte-mask for the source, so the tail
+                // of the f32 destination is stored element by element
+                const Xmm xr_tmp(vreg_dst_s32(jj, ll).getIdx());
+                const int xmm_elems = 4;
+                for (int i = 0; i < math::ilog2q(msk + 1); i++) {
+                    if (i % xmm_elems == 0)
+                        vextractf128(xr_tmp, vreg_dst_f32(jj, ll),
+                                i / xmm_elems);
+                    vpextrd(ptr[reg_ptr_dst_i8 + offset
+                                    + i * data_type_size(f32)],
+                            xr_tmp, i % xmm_elems);
+                }
+            } else
+                vmovups(ptr[reg_ptr_dst_i8 + offset], vreg_dst_f32(jj, ll));
+            break;
         default: assert(!"unsuppotred dst data_type");
     }
 }
@@ -774,8 +799,11 @@ void jit_uni_i8i8_pooling_fwd_ker_t<avx512_core>::store_dst_avg_op(
 
     const Vmm &vr_dst
             = masked ? vreg_dst_s32(jj, ll) | mask(ll) : vreg_dst_s32(jj, ll);
+    const Vmm &vr_dst_f32
+            = masked ? vreg_dst_f32(jj, ll) | mask(ll) : vreg_dst_f32(jj, ll);
 
     switch (jpp.dst_dt) {
+        case f32: vmovups(ptr[reg_ptr_dst_i8 + offset], vr_dst_f32); break;
         case s32: vmovups(ptr[reg_ptr_dst_i8 + offset], vr_dst); break;
         case s8: vpmovsdb(ptr[reg_ptr_dst_i8 + offset], vr_dst); break;
         case u8: vpmovusdb(ptr[reg_ptr_dst_i8 + offset], vr_dst); break;
@@ -1013,12 +1041,14 @@ void jit_uni_i8i8_pooling_fwd_ker_t<isa>::compute_avg_step(
                             reg_dst_f32.getIdx(), rhs_arg_params);
                 }
 
-                uni_vcvtps2dq(reg_dst_s32, reg_dst_f32);
+                if (jpp.dst_dt != f32) {
+                    uni_vcvtps2dq(reg_dst_s32, reg_dst_f32);
 
-                if (jpp.with_postops)
-                    if (jpp.dst_dt == u8) {
-                        uni_vpmaxsd(reg_dst_s32, reg_dst_s32, vreg_zeros);
-                    }
+                    if (jpp.with_postops)
+                        if (jpp.dst_dt == u8) {
+                            uni_vpmaxsd(reg_dst_s32, reg_dst_s32, vreg_zeros);
+                        }
+                }
                 store_dst(jj, ll, c_tail);
             }
         }
@@ -1437,6 +1467,8 @@ void jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
     const auto &jpp = pd()->jpp_;
     const auto post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(jpp.post_ops, ctx);
+    // output scale is applied together with the averaging divider
+    const float output_scale = pd()->attr()->output_scales_.scales_[0];
     /* Calculate when the memory-access will happen outisde of the memory
      * boundary, if so, compute a safe memory access. */
     const auto src_safe_access = reinterpret_cast<char *>(
@@ -1474,7 +1506,7 @@ void jit_uni_i8i8_pooling_fwd_t<isa>::execute_forward(
                 p.kd_range = (size_t)(kd_end - kd_start);
                 p.kh_range = (size_t)(kh_end - kh_start);
                 p.kw_range = (size_t)(kw_end - kw_start);
-                p.idivider = 1.0f
+                p.idivider = output_scale
                         / ((jpp.alg == pooling_avg_exclude_padding)
                                         ? p.kd_range * p.kh_range * p.kw_range
                                         : jpp.kd * jpp.kh * jpp.kw);
@@ -51,9 +51,17 @@ struct jit_uni_i8i8_pooling_fwd_t : public primitive_t {
                             alg_kind::pooling_avg_exclude_padding)
                     && utils::one_of(src_md()->data_type, data_type::s32,
                             data_type::s8, data_type::u8)
-                    && src_md()->data_type == dst_md()->data_type
+                    && (src_md()->data_type == dst_md()->data_type
+                            || (utils::one_of(src_md()->data_type,
+                                        data_type::s8, data_type::u8)
+                                    && dst_md()->data_type == data_type::f32
+                                    && desc()->alg_kind
+                                            != alg_kind::pooling_max))
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::post_ops)
+                            primitive_attr_t::skip_mask_t::post_ops
+                                    | primitive_attr_t::skip_mask_t::oscale,
+                            dst_md()->data_type)
+                    && attr_oscale_ok()
                     && memory_desc_matches_one_of_tag(*src_md(),
                                format_tag::nwc, format_tag::nhwc,
                                format_tag::ndhwc)
@@ -72,6 +80,15 @@ struct jit_uni_i8i8_pooling_fwd_t : public primitive_t {
 
     protected:
         status_t jit_conf();
+
+        // Only a common scale is supported, it is applied together with
+        // the averaging divider, so max pooling requires the default one.
+        bool attr_oscale_ok() const {
+            const auto &oscale = attr()->output_scales_;
+            return oscale.mask_ == 0
+                    && IMPLICATION(!oscale.has_default_values(),
+                            desc()->alg_kind != alg_kind::pooling_max);
+        }
     };
 
     jit_uni_i8i8_pooling_fwd_t(const pd_t *apd);
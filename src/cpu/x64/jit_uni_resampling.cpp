@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -39,25 +39,39 @@ template <cpu_isa_t isa>
 status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     using namespace format_tag;
     using namespace data_type;
+    using sm = primitive_attr_t::skip_mask_t;
 
-    conf_.data_type = src_md()->data_type;
+    conf_.src_data_type = src_md()->data_type;
+    conf_.dst_data_type = dst_md()->data_type;
+
+    const bool is_bf16 = utils::one_of(
+            bf16, conf_.src_data_type, conf_.dst_data_type);
+
+    const bool is_int8
+            = utils::one_of(conf_.src_data_type, s8, u8)
+            || utils::one_of(conf_.dst_data_type, s8, u8);
 
     const bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-            && utils::one_of(conf_.data_type, f32, bf16)
-            && IMPLICATION(conf_.data_type == bf16,
+            && utils::one_of(conf_.src_data_type, f32, bf16, s8, u8)
+            && utils::one_of(conf_.dst_data_type, f32, bf16, s8, u8)
+            // int8 data is processed in 256-bit registers for avx,
+            // which requires the integer instructions of avx2.
+            && IMPLICATION(is_int8 && isa == avx, mayiuse(avx2))
+            && IMPLICATION(is_bf16,
                     // extra check for isa is required because
                     // the avx512_common version may reject a
                     // problem because it is blocked by 8
                     // instead of 16.
                     is_superset(isa, avx512_common) && mayiuse(avx512_core))
-            && utils::everyone_is(
-                    conf_.data_type, src_md()->data_type, dst_md()->data_type)
-            && platform::has_data_type_support(conf_.data_type)
+            && platform::has_data_type_support(conf_.src_data_type)
+            && platform::has_data_type_support(conf_.dst_data_type)
             && set_default_params() == status::success
-            && attr()->has_default_values();
+            && attr()->has_default_values(
+                    sm::oscale | sm::post_ops, conf_.dst_data_type)
+            && attr()->output_scales_.mask_ == 0;
     if (!ok) return status::unimplemented;
 
-    if (conf_.data_type == bf16)
+    if (is_bf16)
         conf_.isa = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
     else if (isa != avx512_common)
         conf_.isa = mayiuse(avx2) ? avx2 : isa;
@@ -76,12 +90,13 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
     if (conf_.alg == alg_kind::resampling_linear)
         conf_.number_of_corners = pow(2, conf_.ndims - 2);
 
-    conf_.dt_size = types::data_type_size(conf_.data_type);
+    conf_.src_dt_size = types::data_type_size(conf_.src_data_type);
+    conf_.dst_dt_size = types::data_type_size(conf_.dst_data_type);
 
     const size_t L3_size = static_cast<size_t>(dnnl_get_max_threads())
             * platform::get_per_core_cache_size(3);
-    size_t input_data_size = conf_.dt_size;
-    size_t output_data_size = conf_.dt_size;
+    size_t input_data_size = conf_.src_dt_size;
+    size_t output_data_size = conf_.dst_dt_size;
     for (unsigned i = 0; i < conf_.ndims; ++i) {
         output_data_size *= dst_md()->dims[i];
         input_data_size *= src_md()->dims[i];
@@ -91,9 +106,9 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     const memory_desc_wrapper src_d(src_md());
     conf_.inner_stride = src_d.blocking_desc().strides[ndims() - 1];
-    conf_.stride_d = IH() * IW() * conf_.inner_stride * conf_.dt_size;
-    conf_.stride_h = IW() * conf_.inner_stride * conf_.dt_size;
-    conf_.stride_w = conf_.inner_stride * conf_.dt_size;
+    conf_.stride_d = IH() * IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_h = IW() * conf_.inner_stride * conf_.src_dt_size;
+    conf_.stride_w = conf_.inner_stride * conf_.src_dt_size;
 
     conf_.simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
 
@@ -117,6 +132,8 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
         conf_.tag_kind = jit_memory_tag_kind_t::nspc;
         conf_.tail = conf_.inner_stride % conf_.simd_w;
     } else if (memory_desc_matches_tag(*dst_md(), ncsp_format)) {
+        // Single bytes can't be gathered efficiently.
+        if (is_int8) return status::unimplemented;
         conf_.tag_kind = jit_memory_tag_kind_t::ncsp;
         if (conf_.alg == alg_kind::resampling_nearest)
             conf_.tail = conf_.ow % conf_.simd_w;
@@ -127,13 +144,56 @@ status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     conf_.el_size_of_indices = sizeof(unsigned);
 
+    const auto &oscale = attr()->output_scales_;
+    conf_.output_scale = oscale.scales_[0];
+    conf_.with_scales = !oscale.has_default_values()
+            && conf_.alg == alg_kind::resampling_nearest;
+
+    if (!post_ops_ok()) return status::unimplemented;
+
     return status::success;
 }
 
+template <cpu_isa_t isa>
+bool jit_uni_resampling_fwd_t<isa>::pd_t::post_ops_ok() {
+    const auto &post_ops = attr()->post_ops_;
+    const memory_desc_wrapper dst_d(dst_md());
+
+    conf_.with_eltwise = false;
+    conf_.with_binary = false;
+
+    for (const auto &entry : post_ops.entry_) {
+        if (entry.is_eltwise()) {
+            conf_.with_eltwise = true;
+        } else if (entry.is_binary()) {
+            // The binary injector loads bf16 data for avx512_core only.
+            if (entry.binary.src1_desc.data_type == data_type::bf16)
+                return false;
+            conf_.with_binary = true;
+        } else
+            return false;
+    }
+
+    conf_.with_postops = conf_.with_eltwise || conf_.with_binary;
+    conf_.post_ops = post_ops;
+
+    // The kernel processes the whole channel block, the values computed for
+    // the padded channels would be spoiled by the post-ops.
+    const bool c_padded = conf_.tag_kind == jit_memory_tag_kind_t::blocked
+            && C() % conf_.inner_stride != 0;
+
+    return IMPLICATION(conf_.with_postops, !c_padded)
+            && binary_injector::binary_args_broadcast_supported(
+                    post_ops, dst_d,
+                    jit_uni_resampling_kernel<
+                            isa>::get_supported_bcast_strategies());
+}
+
 template <cpu_isa_t isa>
 status_t jit_uni_resampling_fwd_t<isa>::init(engine_t *engine) {
-    CHECK(safe_ptr_assign(
-            kernel_, new jit_uni_resampling_kernel<isa>(pd()->get_conf())));
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_resampling_kernel<isa>(
+                    pd()->get_conf(), pd()->dst_md())));
 
     CHECK(kernel_->create_kernel());
 
@@ -187,6 +247,7 @@ status_t jit_uni_resampling_fwd_t<isa>::fill_data_for_linear() {
     const unsigned stride_w = pd()->get_conf().stride_w;
     const unsigned stride_h = pd()->get_conf().stride_h;
     const unsigned stride_d = pd()->get_conf().stride_d;
+    const float output_scale = pd()->get_conf().output_scale;
 
     unsigned num_of_elements = 0;
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
@@ -223,7 +284,7 @@ status_t jit_uni_resampling_fwd_t<isa>::fill_data_for_linear() {
                     weights_[i * weights_stride + offset]
                             = coeffs_id.wei[corners.test(2)]
                             * coeffs_ih.wei[corners.test(1)]
-                            * coeffs_iw.wei[corners.test(0)];
+                            * coeffs_iw.wei[corners.test(0)] * output_scale;
                 }
             }
         });
@@ -248,8 +309,10 @@ status_t jit_uni_resampling_fwd_t<isa>::fill_data_for_linear() {
             // the other because in the kernel these values
             // are read one by one, which makes it easier
             // to read and makes the operation faster.
-            weights_w[2 * ow] = coeffs_iw.wei[0];
-            weights_w[2 * ow + 1] = coeffs_iw.wei[1];
+            // The output scale is folded into the weights for the width,
+            // they are applied exactly once for every output point.
+            weights_w[2 * ow] = coeffs_iw.wei[0] * output_scale;
+            weights_w[2 * ow + 1] = coeffs_iw.wei[1] * output_scale;
             indices_w[2 * ow] = coeffs_iw.idx[0] * stride_w;
             indices_w[2 * ow + 1] = coeffs_iw.idx[1] * stride_w;
         }
@@ -284,9 +347,17 @@ status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
+    const std::vector<const void *> post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->get_conf().post_ops, ctx);
+
     switch (pd()->desc()->alg_kind) {
-        case alg_kind::resampling_nearest: return interpolate_nearest(src, dst);
-        case alg_kind::resampling_linear: return interpolate_linear(src, dst);
+        case alg_kind::resampling_nearest:
+            return interpolate_nearest(
+                    src, dst, post_ops_binary_rhs_arg_vec.data());
+        case alg_kind::resampling_linear:
+            return interpolate_linear(
+                    src, dst, post_ops_binary_rhs_arg_vec.data());
         default:
             assert(!"Invalid resampling algorithm.");
             return status::invalid_arguments;
@@ -294,9 +365,10 @@ status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 }
 
 template <cpu_isa_t isa>
-status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
-        const uint8_t *src, uint8_t *dst) const {
-    const size_t dt_size = pd()->get_conf().dt_size;
+status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(const uint8_t *src,
+        uint8_t *dst, const void *post_ops_binary_rhs_arg_vec) const {
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
     const size_t inner_stride = pd()->get_conf().inner_stride;
 
     const dim_t MB = pd()->MB();
@@ -317,30 +389,35 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
         parallel_nd(MB, C, OD, [&](dim_t mb, dim_t c, dim_t od) {
             const dim_t src_off
-                    = (mb * C + c) * ID * IH * IW * dt_size + indices_d[od];
-            const dim_t dst_off
-                    = ((mb * C + c) * OD * OH * OW + od * OH * OW) * dt_size;
+                    = (mb * C + c) * ID * IH * IW * src_dt_size + indices_d[od];
+            const dim_t dst_off = ((mb * C + c) * OD * OH * OW + od * OH * OW)
+                    * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.src = src + src_off;
             args.dst = dst + dst_off;
             args.indices = &indices_h[0];
+            args.c_offset = static_cast<size_t>(c);
+            args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
 
             (*kernel_)(&args);
         });
     } else if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::nspc
             || pd()->get_conf().tag_kind == jit_memory_tag_kind_t::blocked) {
         parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
-            const dim_t src_off = nsp * ID * IH * IW * inner_stride * dt_size
+            const dim_t src_off
+                    = nsp * ID * IH * IW * inner_stride * src_dt_size
                     + indices_d[od] + indices_h[oh];
-            const dim_t dst_off
-                    = ((nsp * OD + od) * OH + oh) * OW * inner_stride * dt_size;
+            const dim_t dst_off = ((nsp * OD + od) * OH + oh) * OW
+                    * inner_stride * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW;
             args.src = src + src_off;
             args.dst = dst + dst_off;
             args.indices = &indices_w[0];
+            args.c_offset = static_cast<size_t>((nsp % CB) * inner_stride);
+            args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
 
             (*kernel_)(&args);
         });
@@ -353,9 +430,10 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_nearest(
 }
 
 template <cpu_isa_t isa>
-status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
-        const uint8_t *src, uint8_t *dst) const {
-    const size_t dt_size = pd()->get_conf().dt_size;
+status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(const uint8_t *src,
+        uint8_t *dst, const void *post_ops_binary_rhs_arg_vec) const {
+    const size_t src_dt_size = pd()->get_conf().src_dt_size;
+    const size_t dst_dt_size = pd()->get_conf().dst_dt_size;
     const size_t inner_stride = pd()->get_conf().inner_stride;
 
     const dim_t MB = pd()->MB();
@@ -371,8 +449,8 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
 
     if (pd()->get_conf().tag_kind == jit_memory_tag_kind_t::ncsp) {
         parallel_nd(MB, C, [&](dim_t mb, dim_t c) {
-            const dim_t src_off = (mb * C + c) * ID * IH * IW * dt_size;
-            const dim_t dst_off = (mb * C + c) * OD * OH * OW * dt_size;
+            const dim_t src_off = (mb * C + c) * ID * IH * IW * src_dt_size;
+            const dim_t dst_off = (mb * C + c) * OD * OH * OW * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW * OH * OD;
@@ -380,6 +458,8 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
             args.dst = dst + dst_off;
             args.indices = &indices_[0];
             args.weights = &weights_[0];
+            args.c_offset = static_cast<size_t>(c);
+            args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
 
             (*kernel_)(&args);
         });
@@ -395,9 +475,10 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
         const float *weights_back = &weights_[2 * (OW + OH) + OD];
 
         parallel_nd(nsp_outer, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
-            const dim_t src_off = nsp * ID * IH * IW * inner_stride * dt_size;
+            const dim_t src_off
+                    = nsp * ID * IH * IW * inner_stride * src_dt_size;
             const dim_t dst_off = (((nsp * OD + od) * OH + oh) * OW)
-                    * inner_stride * dt_size;
+                    * inner_stride * dst_dt_size;
 
             jit_resampling_call_s args = jit_resampling_call_s();
             args.batch_of_sp_points_to_process = OW;
@@ -413,6 +494,8 @@ status_t jit_uni_resampling_fwd_t<isa>::interpolate_linear(
             args.weight_back = weights_back[od];
             args.weight_top = weights_top[oh];
             args.weight_bottom = weights_bottom[oh];
+            args.c_offset = static_cast<size_t>((nsp % CB) * inner_stride);
+            args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
 
             (*kernel_)(&args);
         });
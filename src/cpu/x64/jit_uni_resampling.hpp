@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -47,6 +47,8 @@ struct jit_uni_resampling_fwd_t : public primitive_t {
         jit_resampling_conf_t get_conf() const { return conf_; };
 
     private:
+        bool post_ops_ok();
+
         jit_resampling_conf_t conf_;
     };
 
@@ -165,8 +167,10 @@ private:
      * ...
      */
 
-    status_t interpolate_nearest(const uint8_t *src, uint8_t *dst) const;
-    status_t interpolate_linear(const uint8_t *src, uint8_t *dst) const;
+    status_t interpolate_nearest(const uint8_t *src, uint8_t *dst,
+            const void *post_ops_binary_rhs_arg_vec) const;
+    status_t interpolate_linear(const uint8_t *src, uint8_t *dst,
+            const void *post_ops_binary_rhs_arg_vec) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -32,15 +32,44 @@ using namespace format_tag;
 
 template <cpu_isa_t isa>
 jit_uni_resampling_kernel<isa>::jit_uni_resampling_kernel(
-        const jit_resampling_conf_t conf)
+        const jit_resampling_conf_t conf, const memory_desc_t *dst_md)
     : jit_generator(nullptr, MAX_CODE_SIZE, true, isa), conf_(conf) {
-    const bool use_bf16_emulation = conf_.data_type == data_type::bf16
+    const bool use_bf16_emulation = conf_.dst_data_type == data_type::bf16
             && conf_.isa != avx512_core_bf16;
     bf16_emulation_ = use_bf16_emulation
             ? utils::make_unique<bf16_emulation_t>(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
                     bf16_emu_reserv_4)
             : nullptr;
+
+    if (conf_.with_postops) {
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = true;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        static constexpr bool save_state = true;
+
+        const binary_injector::rhs_arg_static_params_t rhs_sp {
+                static_cast<std::size_t>(vmm_post_op_helper_.getIdx()),
+                reg_rhs_addr_, reg_rhs_helper_, preserve_gpr, preserve_vmm,
+                GET_OFF(post_ops_binary_rhs_arg_vec),
+                memory_desc_wrapper(*dst_md),
+                static_cast<std::size_t>(conf_.tail), k_tail_mask_,
+                use_exact_tail_scalar_bcast};
+        const binary_injector::static_params_t bsp {
+                reg_param, get_supported_bcast_strategies(), rhs_sp};
+        const eltwise_injector::static_params_t esp {
+                save_state, reg_tmp_, k_eltwise_mask_};
+
+        postops_injector_
+                = utils::make_unique<injector::jit_uni_postops_injector_t<isa>>(
+                        this, conf_.post_ops, bsp, esp);
+    }
+}
+
+template <cpu_isa_t isa>
+bcast_set_t jit_uni_resampling_kernel<isa>::get_supported_bcast_strategies() {
+    return {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+            broadcasting_strategy_t::per_oc_spatial};
 }
 
 template <cpu_isa_t isa>
@@ -67,7 +96,7 @@ template <>
 void jit_uni_resampling_kernel<avx512_common>::emu_gather_data(
         const Reg64 &reg_src_addr, const int indices_idx, const int data_idx,
         const bool is_tail) {
-    assert(conf_.data_type == data_type::bf16);
+    assert(conf_.src_data_type == data_type::bf16);
 
     const Xmm xmm_tmp = Xmm(vmm_full_mask_.getIdx());
     const Xmm xmm_dst = Xmm(vmm_tmp_.getIdx());
@@ -155,7 +184,7 @@ template <>
 void jit_uni_resampling_kernel<avx512_common>::gather_data(
         const Reg64 &reg_src_addr, const int indices_idx, const int data_idx,
         const bool is_tail) {
-    if (conf_.data_type == data_type::f32) {
+    if (conf_.src_data_type == data_type::f32) {
         const Opmask &mask = is_tail ? k_tail_mask_ : k_full_mask_;
         if (!is_tail) {
             // Have to set the all bits to 1 gather full
@@ -199,10 +228,56 @@ void jit_uni_resampling_kernel<sse41>::gather_data(const Reg64 &reg_src_addr,
     emu_gather_data(reg_src_addr, indices_idx, data_idx, is_tail);
 }
 
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::saturate_and_cvt_to_s32(
+        const int data_idx) {
+    const Vmm vmm_data = Vmm(data_idx);
+    constexpr int vlen = cpu_isa_traits<isa>::vlen;
+
+    uni_vmaxps(vmm_data, vmm_data, ptr[rip + l_saturation_table_]);
+    uni_vminps(vmm_data, vmm_data, ptr[rip + l_saturation_table_ + vlen]);
+    uni_vcvtps2dq(vmm_data, vmm_data);
+}
+
+template <>
+void jit_uni_resampling_kernel<avx512_common>::store_int8_data(
+        const int data_idx, const Reg64 &reg_dst_addr, const int offset,
+        const bool is_tail) {
+    saturate_and_cvt_to_s32(data_idx);
+
+    const Zmm zmm_data = Zmm(data_idx);
+    if (is_tail) {
+        // Down-converting stores can't be masked here, so the tail is
+        // converted in a register and stored by bytes.
+        const Xmm xmm_data = Xmm(data_idx);
+        if (conf_.dst_data_type == data_type::s8)
+            vpmovsdb(xmm_data, zmm_data);
+        else
+            vpmovusdb(xmm_data, zmm_data);
+        vextracti32x4(xmm_int8_tail_, zmm_data, 0);
+        store_bytes(xmm_int8_tail_, reg_dst_addr, offset, conf_.tail);
+    } else {
+        if (conf_.dst_data_type == data_type::s8)
+            vpmovsdb(ptr[reg_dst_addr + offset], zmm_data);
+        else
+            vpmovusdb(ptr[reg_dst_addr + offset], zmm_data);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::store_int8_data(const int data_idx,
+        const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
+    saturate_and_cvt_to_s32(data_idx);
+    jit_generator::store_data(conf_.dst_data_type, Vmm(data_idx), reg_dst_addr,
+            offset, is_tail ? conf_.tail : conf_.simd_w);
+}
+
 template <>
 void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
+    if (utils::one_of(conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        store_int8_data(data_idx, reg_dst_addr, offset, is_tail);
+    } else if (conf_.dst_data_type == data_type::bf16) {
         const Ymm to_store_data = Ymm(data_idx);
 
         if (bf16_emulation_)
@@ -233,7 +308,9 @@ void jit_uni_resampling_kernel<avx512_common>::store_data(const int data_idx,
 template <>
 void jit_uni_resampling_kernel<avx>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        store_int8_data(data_idx, reg_dst_addr, offset, is_tail);
+    } else if (is_tail) {
         vmaskmovps(ptr[reg_dst_addr + offset], vmm_tail_mask_, Vmm(data_idx));
     } else {
         if (conf_.is_data_size_bigger_than_L3 && conf_.tail == 0
@@ -247,9 +324,11 @@ void jit_uni_resampling_kernel<avx>::store_data(const int data_idx,
 template <>
 void jit_uni_resampling_kernel<sse41>::store_data(const int data_idx,
         const Reg64 &reg_dst_addr, const int offset, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        store_int8_data(data_idx, reg_dst_addr, offset, is_tail);
+    } else if (is_tail) {
         for (unsigned i = 0; i < conf_.tail; i++) {
-            pextrd(ptr[reg_dst_addr + offset + i * conf_.dt_size],
+            pextrd(ptr[reg_dst_addr + offset + i * conf_.dst_dt_size],
                     Xmm(data_idx), i);
         }
     } else {
@@ -257,11 +336,35 @@ void jit_uni_resampling_kernel<sse41>::store_data(const int data_idx,
     }
 }
 
+template <>
+void jit_uni_resampling_kernel<avx512_common>::load_int8_data(
+        const Reg64 &reg_src_addr, const int offset, const int data_idx,
+        const bool is_tail) {
+    const Zmm loaded_data = is_tail
+            ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
+            : Zmm(data_idx);
+    if (conf_.src_data_type == data_type::s8)
+        vpmovsxbd(loaded_data, ptr[reg_src_addr + offset]);
+    else
+        vpmovzxbd(loaded_data, ptr[reg_src_addr + offset]);
+    vcvtdq2ps(Zmm(data_idx), Zmm(data_idx));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::load_int8_data(const Reg64 &reg_src_addr,
+        const int offset, const int data_idx, const bool is_tail) {
+    jit_generator::load_data(conf_.src_data_type, Vmm(data_idx), reg_src_addr,
+            offset, is_tail ? conf_.tail : conf_.simd_w);
+    uni_vcvtdq2ps(Vmm(data_idx), Vmm(data_idx));
+}
+
 template <>
 void jit_uni_resampling_kernel<avx512_common>::load_data(
         const Reg64 &reg_src_addr, const int offset, const int data_idx,
         const bool is_tail) {
-    if (conf_.data_type == data_type::bf16) {
+    if (utils::one_of(conf_.src_data_type, data_type::s8, data_type::u8)) {
+        load_int8_data(reg_src_addr, offset, data_idx, is_tail);
+    } else if (conf_.src_data_type == data_type::bf16) {
         const Zmm loaded_data = is_tail
                 ? Zmm(data_idx) | k_tail_mask_ | Xbyak::util::T_z
                 : Zmm(data_idx);
@@ -280,7 +383,9 @@ void jit_uni_resampling_kernel<avx512_common>::load_data(
 template <>
 void jit_uni_resampling_kernel<avx>::load_data(const Reg64 &reg_src_addr,
         const int offset, const int data_idx, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.src_data_type, data_type::s8, data_type::u8)) {
+        load_int8_data(reg_src_addr, offset, data_idx, is_tail);
+    } else if (is_tail) {
         vmaskmovps(Vmm(data_idx), vmm_tail_mask_, ptr[reg_src_addr + offset]);
     } else {
         vmovups(Vmm(data_idx), ptr[reg_src_addr + offset]);
@@ -290,16 +395,38 @@ void jit_uni_resampling_kernel<avx>::load_data(const Reg64 &reg_src_addr,
 template <>
 void jit_uni_resampling_kernel<sse41>::load_data(const Reg64 &reg_src_addr,
         const int offset, const int data_idx, const bool is_tail) {
-    if (is_tail) {
+    if (utils::one_of(conf_.src_data_type, data_type::s8, data_type::u8)) {
+        load_int8_data(reg_src_addr, offset, data_idx, is_tail);
+    } else if (is_tail) {
         for (unsigned i = 0; i < conf_.tail; i++) {
             pinsrd(Xmm(data_idx),
-                    ptr[reg_src_addr + offset + i * conf_.dt_size], i);
+                    ptr[reg_src_addr + offset + i * conf_.src_dt_size], i);
         }
     } else {
         movups(Vmm(data_idx), ptr[reg_src_addr + offset]);
     }
 }
 
+template <cpu_isa_t isa>
+void jit_uni_resampling_kernel<isa>::apply_scale_and_postops(
+        const int data_idx, const bool is_tail, const Reg64 *reg_c) {
+    if (conf_.with_scales)
+        uni_vmulps(Vmm(data_idx), Vmm(data_idx), vmm_scale_);
+
+    if (!conf_.with_postops) return;
+
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+    if (conf_.with_binary) {
+        if (reg_c)
+            rhs_arg_params.vmm_idx_to_oc_off_oprnd.emplace(data_idx, *reg_c);
+        rhs_arg_params.vmm_idx_to_oc_elem_off_addr.emplace(
+                data_idx, ptr[reg_param + GET_OFF(c_offset)]);
+        if (is_tail) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+    }
+
+    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+}
+
 template <cpu_isa_t isa>
 void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
     const Reg64 &reg_indices_h = reg_aux_src_0_;
@@ -311,6 +438,7 @@ void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
         uni_vmovdqu(vmm_indices_, ptr[reg_indices_w]);
         gather_data(reg_src_shifted, vmm_indices_.getIdx(), vmm_src_.getIdx(),
                 is_tail);
+        apply_scale_and_postops(vmm_src_.getIdx(), is_tail);
         store_data(vmm_src_.getIdx(), reg_dst_, 0, is_tail);
     });
 
@@ -343,7 +471,7 @@ void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
 
             nearest_interpolation(false);
 
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
             add(reg_indices_w, conf_.simd_w * conf_.el_size_of_indices);
             sub(reg_work_, conf_.simd_w);
 
@@ -353,7 +481,7 @@ void jit_uni_resampling_kernel<isa>::nearest_ncsp_format() {
 
         if (conf_.tail > 0) {
             nearest_interpolation(true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         add(reg_indices_h, conf_.el_size_of_indices);
@@ -382,26 +510,28 @@ void jit_uni_resampling_kernel<isa>::nearest_c_oriented_format() {
         add(reg_src_shifted, reg_tmp1_);
 
         Label c_loop_begin, c_loop_end;
-        mov(reg_c, conf_.inner_stride);
+        xor_(reg_c, reg_c);
         L(c_loop_begin);
         {
-            cmp(reg_c, conf_.simd_w);
-            jl(c_loop_end, T_NEAR);
+            cmp(reg_c, static_cast<int>(conf_.inner_stride - conf_.simd_w));
+            jg(c_loop_end, T_NEAR);
 
             load_data(reg_src_shifted, 0, vmm_src_.getIdx());
+            apply_scale_and_postops(vmm_src_.getIdx(), false, &reg_c);
             store_data(vmm_src_.getIdx(), reg_dst_);
-            add(reg_src_shifted, conf_.simd_w * conf_.dt_size);
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_src_shifted, conf_.simd_w * conf_.src_dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
 
-            sub(reg_c, conf_.simd_w);
+            add(reg_c, conf_.simd_w);
             jmp(c_loop_begin, T_NEAR);
         }
         L(c_loop_end);
 
         if (conf_.tail > 0) {
             load_data(reg_src_shifted, 0, vmm_src_.getIdx(), true);
+            apply_scale_and_postops(vmm_src_.getIdx(), true, &reg_c);
             store_data(vmm_src_.getIdx(), reg_dst_, 0, true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         add(reg_indices_, conf_.el_size_of_indices);
@@ -432,6 +562,7 @@ void jit_uni_resampling_kernel<isa>::linear_ncsp_format() {
             uni_vfmadd231ps(Vmm(vmm_idx(0)), Vmm(vmm_idx(i)), vmm_weights_);
         }
 
+        apply_scale_and_postops(vmm_idx(0), is_tail);
         store_data(vmm_idx(0), reg_dst_, 0, is_tail);
     });
 
@@ -444,7 +575,7 @@ void jit_uni_resampling_kernel<isa>::linear_ncsp_format() {
 
         linear_interpolation(false);
 
-        add(reg_dst_, conf_.simd_w * conf_.dt_size);
+        add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
         add(reg_weights, conf_.simd_w * sizeof(float));
         add(reg_indices_, conf_.simd_w * conf_.el_size_of_indices);
         sub(reg_work_, conf_.simd_w);
@@ -502,6 +633,7 @@ void jit_uni_resampling_kernel<isa>::linear_c_oriented_format() {
             uni_vfmadd231ps(src_ftl_, src_btl_, weight_back_);
         }
 
+        apply_scale_and_postops(src_ftl_.getIdx(), is_tail, &reg_c);
         store_data(src_ftl_.getIdx(), reg_dst_, offset, is_tail);
     });
 
@@ -531,26 +663,26 @@ void jit_uni_resampling_kernel<isa>::linear_c_oriented_format() {
         uni_vbroadcastss(weight_right_, ptr[reg_weights + sizeof(float)]);
 
         Label c_loop_begin, c_loop_end;
-        mov(reg_c, conf_.inner_stride);
+        xor_(reg_c, reg_c);
         L(c_loop_begin);
         {
-            cmp(reg_c, conf_.simd_w);
-            jl(c_loop_end, T_NEAR);
+            cmp(reg_c, static_cast<int>(conf_.inner_stride - conf_.simd_w));
+            jg(c_loop_end, T_NEAR);
 
             linear_interpolation(0, false);
-            add(reg_dst_, conf_.simd_w * conf_.dt_size);
+            add(reg_dst_, conf_.simd_w * conf_.dst_dt_size);
 
             for (unsigned i = 0; i < conf_.number_of_corners; i++)
-                add(src_regs[i], conf_.simd_w * conf_.dt_size);
+                add(src_regs[i], conf_.simd_w * conf_.src_dt_size);
 
-            sub(reg_c, conf_.simd_w);
+            add(reg_c, conf_.simd_w);
             jmp(c_loop_begin, T_NEAR);
         }
         L(c_loop_end);
 
         if (conf_.tail > 0) {
             linear_interpolation(0, true);
-            add(reg_dst_, conf_.tail * conf_.dt_size);
+            add(reg_dst_, conf_.tail * conf_.dst_dt_size);
         }
 
         // During one loop cycle are read two values for left and
@@ -594,6 +726,11 @@ void jit_uni_resampling_kernel<isa>::generate() {
 
     if (conf_.tail > 0) prepare_mask();
 
+    if (conf_.with_scales) {
+        mov(reg_tmp_, reinterpret_cast<size_t>(&conf_.output_scale));
+        uni_vbroadcastss(vmm_scale_, ptr[reg_tmp_]);
+    }
+
     mov(reg_dst_, ptr[reg_param + GET_OFF(dst)]);
     mov(reg_work_, ptr[reg_param + GET_OFF(batch_of_sp_points_to_process)]);
     mov(reg_indices_, ptr[reg_param + GET_OFF(indices)]);
@@ -647,6 +784,23 @@ void jit_uni_resampling_kernel<isa>::generate() {
     }
 
     postamble();
+
+    if (conf_.with_eltwise && postops_injector_)
+        postops_injector_->prepare_table();
+
+    if (utils::one_of(conf_.dst_data_type, data_type::s8, data_type::u8)) {
+        const float lbound = conf_.dst_data_type == data_type::s8
+                ? static_cast<float>(nstl::numeric_limits<int8_t>::lowest())
+                : 0.f;
+        const float ubound = types::max_value<float>(conf_.dst_data_type);
+
+        align(cpu_isa_traits<isa>::vlen);
+        L(l_saturation_table_);
+        for (unsigned i = 0; i < conf_.simd_w; i++)
+            dd(float2int(lbound));
+        for (unsigned i = 0; i < conf_.simd_w; i++)
+            dd(float2int(ubound));
+    }
 }
 
 template struct jit_uni_resampling_kernel<avx512_common>;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -38,10 +39,13 @@ struct jit_uni_resampling_kernel : public jit_generator {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling)
 
-    jit_uni_resampling_kernel(const jit_resampling_conf_t conf);
+    jit_uni_resampling_kernel(
+            const jit_resampling_conf_t conf, const memory_desc_t *dst_md);
 
     virtual ~jit_uni_resampling_kernel() = default;
 
+    static bcast_set_t get_supported_bcast_strategies();
+
 protected:
     using Xmm = Xbyak::Xmm;
     using Ymm = Xbyak::Ymm;
@@ -78,6 +82,27 @@ protected:
     void load_data(const Reg64 &reg_src_addr, const int offset,
             const int data_idx, const bool is_tail = false);
 
+    /*
+     * Helpers for s8/u8 data. The values are converted to f32 on load,
+     * and on store they are saturated to the destination data type range
+     * and converted back.
+     */
+    void load_int8_data(const Reg64 &reg_src_addr, const int offset,
+            const int data_idx, const bool is_tail);
+    void saturate_and_cvt_to_s32(const int data_idx);
+    void store_int8_data(const int data_idx, const Reg64 &reg_dst_addr,
+            const int offset, const bool is_tail);
+
+    /*
+     * Applies the output scale (nearest algorithm only, for the linear one
+     * it is folded into the interpolation weights) and the post-ops to
+     * the data which is about to be stored. For channel oriented formats
+     * reg_c holds the offset of the processed channels inside the channel
+     * block.
+     */
+    void apply_scale_and_postops(const int data_idx, const bool is_tail,
+            const Reg64 *reg_c = nullptr);
+
     void nearest_ncsp_format();
     void nearest_c_oriented_format();
     void linear_ncsp_format();
@@ -96,9 +121,20 @@ protected:
     const Vmm vmm_weights_ = Vmm(3);
     const Vmm vmm_indices_ = Vmm(4);
     const Vmm vmm_tmp_ = Vmm(5);
+    // Used only for nearest algorithm if output scales are present.
+    const Vmm vmm_scale_ = Vmm(3);
+    // Hint for the binary injector, this register is not used otherwise.
+    const Vmm vmm_post_op_helper_
+            = Vmm(is_superset(isa, avx512_common) ? 11 : 7);
+
+    // Used only for s8/u8 destination on avx512 to store the tail.
+    // It has to be one of the first 16 registers, vmm_tail_mask_
+    // is used for avx only.
+    const Xmm xmm_int8_tail_ = Xmm(0);
 
     const Opmask k_tail_mask_ = k1;
     const Opmask k_full_mask_ = k2;
+    const Opmask k_eltwise_mask_ = k3;
 
     const Zmm bf16_emu_reserv_1 = Zmm(7);
     const Zmm bf16_emu_reserv_2 = Zmm(8);
@@ -118,6 +154,9 @@ protected:
     const Reg64 reg_aux_src_1_ = r10;
     const Reg64 reg_aux_src_2_ = r11;
     const Reg64 reg_tmp1_ = r15;
+    // Used by the binary injector, which preserves their values.
+    const Reg64 reg_rhs_addr_ = rbp;
+    const Reg64 reg_rhs_helper_ = r14;
 
     // Registers which are used only for linear algorithm
     // and for channel oriented formats.
@@ -153,8 +192,14 @@ protected:
     const Reg64 reg_src_bbl_ = r14;
     const Reg64 reg_src_bbr_ = r15;
 
+    // Lower and upper saturation bounds for s8/u8 destination,
+    // each of them fills a whole vector register.
+    Xbyak::Label l_saturation_table_;
+
     const jit_resampling_conf_t conf_;
     std::unique_ptr<bf16_emulation_t> bf16_emulation_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
+            postops_injector_;
 };
 } // namespace x64
 } // namespace cpu
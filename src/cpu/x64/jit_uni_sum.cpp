@@ -0,0 +1,373 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+#define GET_OFF(field) offsetof(jit_uni_sum_call_s, field)
+
+template <cpu_isa_t isa>
+jit_uni_sum_kernel_t<isa>::jit_uni_sum_kernel_t(
+        const std::vector<data_type_t> &src_dts, data_type_t dst_dt)
+    : src_dts_(src_dts)
+    , dst_dt_(dst_dt)
+    , num_srcs_((int)src_dts.size()) {
+    assert(num_srcs_ <= max_num_arrs);
+    // 3 registers are reserved for saturation, 2 per unrolled iteration
+    unroll_ = nstl::min(4, (max_vregs_available() - num_srcs_ - 3) / 2);
+    assert(unroll_ > 0);
+    if (dst_dt_ == bf16 && !mayiuse(avx512_core_bf16))
+        bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
+                bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
+                bf16_emu_reserv_4));
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::load_vector(
+        const Vmm &vmm, const Address &addr, data_type_t dt) {
+    switch (dt) {
+        case f32: uni_vmovups(vmm, addr); break;
+        case s32: uni_vcvtdq2ps(vmm, addr); break;
+        case bf16:
+            vpmovzxwd(vmm, addr);
+            uni_vpslld(vmm, vmm, 16);
+            break;
+        case s8:
+            uni_vpmovsxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        case u8:
+            uni_vpmovzxbd(vmm, addr);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::load_scalar(
+        const Vmm &vmm, const Reg64 &reg_addr, data_type_t dt) {
+    const Xmm xmm(vmm.getIdx());
+    const Reg32 reg_tmp_32 = reg_tmp.cvt32();
+    switch (dt) {
+        case f32: uni_vmovss(xmm, ptr[reg_addr]); break;
+        case s32:
+            uni_vmovss(xmm, ptr[reg_addr]);
+            uni_vcvtdq2ps(xmm, xmm);
+            break;
+        case bf16:
+            movzx(reg_tmp_32, word[reg_addr]);
+            shl(reg_tmp_32, 16);
+            vmovd(xmm, reg_tmp_32);
+            break;
+        case s8:
+        case u8:
+            if (dt == s8)
+                movsx(reg_tmp_32, byte[reg_addr]);
+            else
+                movzx(reg_tmp_32, byte[reg_addr]);
+            vmovd(xmm, reg_tmp_32);
+            uni_vcvtdq2ps(xmm, xmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::saturate(const Vmm &vmm) {
+    if (!utils::one_of(dst_dt_, s32, s8, u8)) return;
+    saturate_f32(vmm, vmm_lbound(), vmm_ubound(), dst_dt_);
+    uni_vcvtps2dq(vmm, vmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::cvt_to_bf16(const Ymm &ymm, const Vmm &vmm) {
+    const Zmm zmm(vmm.getIdx());
+    if (bf16_emu_)
+        bf16_emu_->vcvtneps2bf16(ymm, zmm);
+    else
+        vcvtneps2bf16(ymm, zmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::store_vector(
+        const Address &addr, const Vmm &vmm) {
+    const Xmm xmm(vmm.getIdx());
+    const Ymm ymm(vmm.getIdx());
+    switch (dst_dt_) {
+        case f32: uni_vmovups(addr, vmm); break;
+        case s32: uni_vmovdqu(addr, vmm); break;
+        case bf16:
+            assert(isa == avx512_core);
+            cvt_to_bf16(ymm, vmm);
+            vmovdqu16(addr, ymm);
+            break;
+        case s8:
+        case u8:
+            if (isa == avx512_core) {
+                if (dst_dt_ == s8)
+                    vpmovsdb(xmm, vmm);
+                else
+                    vpmovusdb(xmm, vmm);
+                // the accumulators may live in xmm16-31, use EVEX encoding
+                vmovdqu8(addr, xmm);
+            } else {
+                // s32 -> s16 = {qw0, 0, qw1, 0}
+                vpackssdw(vmm, vmm, vmm_zero());
+                // permute to restore order {qw0, 0, qw1, 0} -> {qw0, qw1, 0, 0}
+                vpermq(ymm, ymm, 0x58);
+                // s16 -> s8/u8 : {16 x s16}{16 x 0} -> {32 x s8/u8}
+                if (dst_dt_ == s8)
+                    vpacksswb(vmm, vmm, vmm_zero());
+                else
+                    vpackuswb(vmm, vmm, vmm_zero());
+                vmovq(addr, xmm);
+            }
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::store_scalar(
+        const Reg64 &reg_addr, const Vmm &vmm) {
+    const Xmm xmm(vmm.getIdx());
+    const Ymm ymm(vmm.getIdx());
+    switch (dst_dt_) {
+        case f32:
+        case s32: uni_vmovss(ptr[reg_addr], xmm); break;
+        case bf16:
+            cvt_to_bf16(ymm, vmm);
+            vmovd(reg_tmp.cvt32(), xmm);
+            mov(word[reg_addr], reg_tmp.cvt16());
+            break;
+        case s8:
+        case u8:
+            vpackssdw(xmm, xmm, xmm);
+            if (dst_dt_ == s8)
+                vpacksswb(xmm, xmm, xmm);
+            else
+                vpackuswb(xmm, xmm, xmm);
+            vmovd(reg_tmp.cvt32(), xmm);
+            mov(byte[reg_addr], reg_tmp.cvt8());
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::loop_iteration(int unroll) {
+    Label loop, loop_end;
+
+    const int dst_dt_size = types::data_type_size(dst_dt_);
+
+    L(loop);
+    {
+        cmp(reg_nelems, unroll * simd_w);
+        jl(loop_end, T_NEAR);
+        for (int i = 0; i < num_srcs_; ++i) {
+            const int src_dt_size = types::data_type_size(src_dts_[i]);
+            for (int u = 0; u < unroll; ++u) {
+                load_vector(vmm_tmp(u),
+                        ptr[reg_src[i] + u * simd_w * src_dt_size],
+                        src_dts_[i]);
+                if (i == 0)
+                    uni_vmulps(vmm_acc(u), vmm_tmp(u), vmm_scale(i));
+                else
+                    uni_vfmadd231ps(vmm_acc(u), vmm_tmp(u), vmm_scale(i));
+            }
+        }
+        for (int u = 0; u < unroll; ++u) {
+            saturate(vmm_acc(u));
+            store_vector(ptr[reg_dst + u * simd_w * dst_dt_size], vmm_acc(u));
+        }
+        for (int i = 0; i < num_srcs_; ++i)
+            add(reg_src[i],
+                    unroll * simd_w * types::data_type_size(src_dts_[i]));
+        add(reg_dst, unroll * simd_w * dst_dt_size);
+        sub(reg_nelems, unroll * simd_w);
+        jmp(loop, T_NEAR);
+    }
+
+    L(loop_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::scalar_loop() {
+    Label loop, loop_end;
+
+    L(loop);
+    {
+        cmp(reg_nelems, 0);
+        jle(loop_end, T_NEAR);
+        for (int i = 0; i < num_srcs_; ++i) {
+            load_scalar(vmm_tmp(0), reg_src[i], src_dts_[i]);
+            if (i == 0)
+                uni_vmulps(vmm_acc(0), vmm_tmp(0), vmm_scale(i));
+            else
+                uni_vfmadd231ps(vmm_acc(0), vmm_tmp(0), vmm_scale(i));
+            add(reg_src[i], types::data_type_size(src_dts_[i]));
+        }
+        saturate(vmm_acc(0));
+        store_scalar(reg_dst, vmm_acc(0));
+        add(reg_dst, types::data_type_size(dst_dt_));
+        dec(reg_nelems);
+        jmp(loop, T_NEAR);
+    }
+
+    L(loop_end);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sum_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_nelems, ptr[reg_param + GET_OFF(nelems)]);
+
+    mov(reg_tmp, ptr[reg_param + GET_OFF(scales)]);
+    for (int i = 0; i < num_srcs_; ++i)
+        uni_vbroadcastss(vmm_scale(i), ptr[reg_tmp + i * sizeof(float)]);
+
+    mov(reg_srcs, ptr[reg_param + GET_OFF(srcs)]);
+    for (int i = 0; i < num_srcs_; ++i)
+        mov(reg_src[i], ptr[reg_srcs + i * sizeof(void *)]);
+
+    init_saturate_f32(vmm_lbound(), vmm_ubound(), reg_tmp, f32, dst_dt_);
+    uni_vpxor(vmm_zero(), vmm_zero(), vmm_zero());
+    if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+    loop_iteration(unroll_);
+    if (unroll_ > 1) loop_iteration(1);
+    scalar_loop();
+
+    postamble();
+}
+
+#undef GET_OFF
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::pd_t::init(engine_t *engine) {
+    using kernel_t = jit_uni_sum_kernel_t<isa>;
+
+    bool ok = mayiuse(isa) && cpu_sum_pd_t::init(engine) == status::success
+            && n_inputs() <= kernel_t::max_num_arrs;
+    if (!ok) return status::unimplemented;
+
+    const memory_desc_wrapper o_d(&dst_md_);
+    ok = utils::one_of(o_d.data_type(), f32, bf16, s32, s8, u8)
+            && IMPLICATION(o_d.data_type() == bf16, isa == avx512_core)
+            && o_d.is_dense(true);
+    if (!ok) return status::unimplemented;
+
+    // The inputs are processed as flat arrays, hence all of them have to
+    // share the physical layout of the destination
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        ok = utils::one_of(i_d.data_type(), f32, bf16, s32, s8, u8)
+                && o_d.similar_to(i_d, true, false, 0) && i_d.is_dense(true);
+        if (!ok) return status::unimplemented;
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::init(engine_t *engine) {
+    std::vector<data_type_t> src_dts;
+    for (int i = 0; i < pd()->n_inputs(); ++i)
+        src_dts.push_back(pd()->src_md(i)->data_type);
+
+    CHECK(safe_ptr_assign(
+            kernel_, new kernel_t(src_dts, pd()->dst_md()->data_type)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sum_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const int num_arrs = pd()->n_inputs();
+
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    auto output = CTX_OUT_MEM(char *, DNNL_ARG_DST)
+            + o_d.blk_off(0) * o_d.data_type_size();
+
+    const char *input_ptrs[kernel_t::max_num_arrs];
+    size_t input_dt_sizes[kernel_t::max_num_arrs];
+    size_t block_bytes = o_d.data_type_size();
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        input_dt_sizes[a] = i_d.data_type_size();
+        input_ptrs[a] = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0) * input_dt_sizes[a];
+        block_bytes += input_dt_sizes[a];
+    }
+
+    // Size the blocks so that the chunks of all the inputs and of the output
+    // processed by a thread at once fit into a half of L1
+    const dim_t nelems = o_d.nelems(true);
+    const dim_t half_L1 = platform::get_per_core_cache_size(1) / 2;
+    const dim_t block_size = utils::rnd_up(
+            utils::div_up(half_L1, (dim_t)block_bytes), kernel_->block_size());
+    const dim_t num_blocks = utils::div_up(nelems, block_size);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(num_blocks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        const dim_t start_e = start * block_size;
+        const dim_t end_e = nstl::min(end * block_size, nelems);
+
+        const void *local_input_ptrs[kernel_t::max_num_arrs];
+        for (int a = 0; a < num_arrs; ++a)
+            local_input_ptrs[a] = input_ptrs[a] + start_e * input_dt_sizes[a];
+
+        auto arg = jit_uni_sum_call_s();
+        arg.srcs = local_input_ptrs;
+        arg.dst = output + start_e * o_d.data_type_size();
+        arg.scales = pd()->scales();
+        arg.nelems = end_e - start_e;
+        (*kernel_)(&arg);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_kernel_t<avx512_core>;
+template struct jit_uni_sum_kernel_t<avx2>;
+template struct jit_uni_sum_t<avx512_core>;
+template struct jit_uni_sum_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SUM_HPP
+#define CPU_X64_JIT_UNI_SUM_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_uni_sum_call_s {
+    const void **srcs;
+    void *dst;
+    const float *scales;
+    size_t nelems;
+};
+
+/* Computes a scaled sum of contiguous chunks of the inputs:
+ *     dst[e] = saturate(sum_i scales[i] * srcs[i][e]), e < nelems
+ * Each input can have its own data type, the accumulation is done in f32. */
+template <cpu_isa_t isa>
+struct jit_uni_sum_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    jit_uni_sum_kernel_t(
+            const std::vector<data_type_t> &src_dts, data_type_t dst_dt);
+    ~jit_uni_sum_kernel_t() = default;
+
+    static constexpr int max_num_arrs = 8;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    // number of elements processed by a single iteration of the main loop
+    int block_size() const { return unroll_ * simd_w; }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using Xmm = Xbyak::Xmm;
+    using Ymm = Xbyak::Ymm;
+    using Zmm = Xbyak::Zmm;
+    using Reg64 = Xbyak::Reg64;
+
+    const std::vector<data_type_t> src_dts_;
+    const data_type_t dst_dt_;
+    const int num_srcs_;
+    int unroll_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_srcs = abi_not_param1;
+    const Reg64 reg_dst = rax;
+    const Reg64 reg_nelems = rdx;
+    const Reg64 reg_tmp = rbx;
+    const Reg64 reg_src[max_num_arrs] = {r8, r9, r10, r11, r12, r13, r14, r15};
+    // used by bf16 emulation only after the source pointers are loaded
+    const Reg64 bf16_emu_scratch = abi_not_param1;
+
+    const Zmm bf16_emu_reserv_1 = Zmm(26);
+    const Zmm bf16_emu_reserv_2 = Zmm(27);
+    const Zmm bf16_emu_reserv_3 = Zmm(28);
+    const Zmm bf16_emu_reserv_4 = Zmm(29);
+
+    static int max_vregs_available() {
+        // 4 zmm registers are reserved for bf16 emulation
+        return isa == avx512_core ? 26 : 16;
+    }
+
+    // vector registers layout:
+    // [scales of every input | lbound, ubound, zero | {acc, tmp} x unroll]
+    Vmm vmm_scale(int i_src) const { return Vmm(i_src); }
+    Vmm vmm_lbound() const { return Vmm(num_srcs_); }
+    Vmm vmm_ubound() const { return Vmm(num_srcs_ + 1); }
+    Vmm vmm_zero() const { return Vmm(num_srcs_ + 2); }
+    Vmm vmm_acc(int u) const { return Vmm(num_srcs_ + 3 + 2 * u); }
+    Vmm vmm_tmp(int u) const { return Vmm(num_srcs_ + 4 + 2 * u); }
+
+    void load_vector(
+            const Vmm &vmm, const Xbyak::Address &addr, data_type_t dt);
+    void load_scalar(const Vmm &vmm, const Reg64 &reg_addr, data_type_t dt);
+    void saturate(const Vmm &vmm);
+    void store_vector(const Xbyak::Address &addr, const Vmm &vmm);
+    void store_scalar(const Reg64 &reg_addr, const Vmm &vmm);
+    void cvt_to_bf16(const Ymm &ymm, const Vmm &vmm);
+
+    void loop_iteration(int unroll);
+    void scalar_loop();
+
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine);
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    using kernel_t = jit_uni_sum_kernel_t<isa>;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -43,7 +43,8 @@ struct ref_concat_t : public gpu_primitive_t {
         DECLARE_CONCAT_PD_T("ref:any", ref_concat_t);
 
         status_t init(engine_t *engine) {
-            status_t status = gpu_concat_pd_t::init();
+            using sm = primitive_attr_t::skip_mask_t;
+            status_t status = gpu_concat_pd_t::init(nullptr, sm::scales);
             if (status != status::success) {
                 assert(dst_md_.format_kind != format_kind::undef);
                 status = dnnl_memory_desc_init_by_strides(&tent_dst_md_,
@@ -51,7 +52,7 @@ struct ref_concat_t : public gpu_primitive_t {
                         nullptr);
                 if (status != status::success) return status::unimplemented;
 
-                status = gpu_concat_pd_t::init(&tent_dst_md_);
+                status = gpu_concat_pd_t::init(&tent_dst_md_, sm::scales);
                 if (status != status::success) return status::unimplemented;
             }
 
@@ -59,8 +60,10 @@ struct ref_concat_t : public gpu_primitive_t {
                 auto r_impls = engine->get_reorder_implementation_list(
                         src_md(i), src_image_md(i));
                 for (auto r = r_impls; *r; ++r) {
-                    primitive_attr_t r_attr; /* alpha == 1. */
+                    primitive_attr_t r_attr;
                     r_attr.set_scratchpad_mode(scratchpad_mode::user);
+                    if (src_scale(i) != 1.f)
+                        r_attr.output_scales_.set(src_scale(i));
                     reorder_pd_t *r_pd = nullptr;
                     if ((*r)(&r_pd, engine, &r_attr, engine, src_md(i), engine,
                                 src_image_md(i))
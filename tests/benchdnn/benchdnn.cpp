@@ -60,6 +60,9 @@ const char *driver_name = "";
 double max_ms_per_prb {3e3};
 int min_times_per_prb {5};
 int fix_times_per_prb {0};
+bool cold_cache {false};
+int n_instances {1};
+int threads_per_instance {0};
 
 bool fast_ref_gpu {true};
 bool allow_enum_tags_only {true};
@@ -132,6 +132,9 @@ extern const char *driver_name;
 extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
+extern bool cold_cache; /** if true rotate through copies of exec args */
+extern int n_instances; /** number of concurrent instances to run prb */
+extern int threads_per_instance; /** if non-zero use that many threads */
 
 extern bool fast_ref_gpu;
 extern bool allow_enum_tags_only;
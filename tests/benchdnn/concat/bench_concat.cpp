@@ -28,11 +28,13 @@
 namespace concat {
 
 void check_correctness(const settings_t &s) {
-    for_(const auto &i_sdt : s.sdt)
+    for_(const auto &i_sdt_ : s.sdt)
     for_(const auto &i_ddt : s.ddt)
     for_(const auto &i_stag_ : s.stag)
     for_(const auto &i_dtag : s.dtag)
     for_(const auto &i_axis : s.axis)
+    for_(const auto &i_scales : s.scales)
+    for_(const auto &i_zero_points : s.zero_points)
     for (const auto &i_scratchpad_mode : s.scratchpad_mode) {
         // if dst is omitted by dtag = tag::undef, omit ddt as well
         auto ddt = i_dtag == tag::undef ? dnnl_data_type_undef : i_ddt;
@@ -44,10 +46,22 @@ void check_correctness(const settings_t &s) {
         if (s.sdims.size() != i_stag.size()) // want 1:1 match of sdims and tag
             SAFE_V(FAIL);
 
+        // broadcast data type if needed
+        auto i_sdt = i_sdt_;
+        if (i_sdt.size() == 1) i_sdt.assign(s.sdims.size(), i_sdt[0]);
+
+        if (s.sdims.size() != i_sdt.size()) // want 1:1 match of sdims and dt
+            SAFE_V(FAIL);
+
+        if (i_scales.size() != 1 && i_scales.size() != s.sdims.size())
+            SAFE_V(FAIL);
+
         attr_t attr;
+        attr.insert(i_zero_points);
         attr.insert(i_scratchpad_mode);
 
-        const prb_t prb(s.sdims, i_sdt, ddt, i_stag, i_dtag, i_axis, attr);
+        const prb_t prb(
+                s.sdims, i_sdt, ddt, i_stag, i_dtag, i_axis, i_scales, attr);
         std::stringstream ss;
         ss << prb;
         const std::string cpp_pstr = ss.str();
@@ -77,11 +91,14 @@ int bench(int argc, char **argv) {
     for (; argc > 0; --argc, ++argv) {
         const bool parsed_options = parse_bench_settings(argv[0])
                 || parse_batch(bench, argv[0])
-                || parse_dt(s.sdt, def.sdt, argv[0], "sdt")
+                || parse_multi_dt(s.sdt, def.sdt, argv[0])
                 || parse_dt(s.ddt, def.ddt, argv[0], "ddt")
                 || parse_multi_tag(s.stag, def.stag, argv[0])
                 || parse_tag(s.dtag, def.dtag, argv[0], "dtag")
                 || parse_axis(s.axis, def.axis, argv[0])
+                || parse_multivector_option(
+                        s.scales, def.scales, atof, argv[0], "scales")
+                || parse_attr_zero_points(s.zero_points, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
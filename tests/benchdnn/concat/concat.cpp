@@ -41,8 +41,8 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 
     for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
         const dims_t &i_sdims = prb->sdims[i_input];
-        SAFE(init_md(&src_d[i_input], prb->ndims, i_sdims.data(), prb->sdt,
-                     prb->stag[i_input]),
+        SAFE(init_md(&src_d[i_input], prb->ndims, i_sdims.data(),
+                     prb->sdt[i_input], prb->stag[i_input]),
                 CRIT);
     }
 
@@ -53,6 +53,13 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
     }
 
     auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args_t());
+    for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
+        if (prb->scales[i_input] == 1.f) continue;
+        DNN_SAFE(dnnl_primitive_attr_set_scales(dnnl_attr,
+                         DNNL_ARG_MULTIPLE_SRC + i_input, 1, 0,
+                         &prb->scales[i_input]),
+                WARN);
+    }
 
     dnnl_status_t init_status = dnnl_concat_primitive_desc_create(&cpd,
             prb->dtag != tag::undef ? &dst_d : nullptr, prb->n_inputs(),
@@ -109,21 +116,25 @@ int fill_src(int input_idx, dnnl_data_type_t dt, dnn_mem_t &mem_dt,
 }
 
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
-    check_known_skipped_case_common({prb->sdt, prb->ddt}, FWD_D, res);
+    std::vector<dnnl_data_type_t> dts = prb->sdt;
+    dts.push_back(prb->ddt);
+    check_known_skipped_case_common(dts, FWD_D, res);
     if (res->state == SKIPPED) return;
 
     // ref concat is reorder-based, hence, inherits some reorder limitations.
     // bf16 reorder on cpu supports only bf16/f32 src_dt/dst_dt
-    bool valid_bf16_input = IMPLICATION(prb->sdt == dnnl_bf16,
-            prb->dtag == tag::undef || prb->ddt == dnnl_f32
-                    || prb->ddt == dnnl_bf16);
-    bool valid_bf16_output
-            = IMPLICATION(prb->ddt == dnnl_bf16 && prb->dtag != tag::undef,
-                    (prb->sdt == dnnl_f32 || prb->sdt == dnnl_bf16));
-
-    if (is_cpu() && (!valid_bf16_input || !valid_bf16_output)) {
-        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
-        return;
+    // if dst is omitted, its data type is the one of the first input
+    const auto ddt = prb->dtag == tag::undef ? prb->sdt[0] : prb->ddt;
+    for (const auto &i_sdt : prb->sdt) {
+        bool valid_bf16_input = IMPLICATION(i_sdt == dnnl_bf16,
+                ddt == dnnl_f32 || ddt == dnnl_bf16);
+        bool valid_bf16_output = IMPLICATION(ddt == dnnl_bf16,
+                (i_sdt == dnnl_f32 || i_sdt == dnnl_bf16));
+
+        if (is_cpu() && (!valid_bf16_input || !valid_bf16_output)) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
     }
 }
 
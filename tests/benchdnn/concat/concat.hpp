@@ -39,10 +39,13 @@ struct settings_t {
 
     std::vector<dims_t> sdims;
 
-    std::vector<dnnl_data_type_t> sdt {dnnl_f32}, ddt {dnnl_f32};
+    std::vector<std::vector<dnnl_data_type_t>> sdt {{dnnl_f32}};
+    std::vector<dnnl_data_type_t> ddt {dnnl_f32};
     std::vector<std::vector<std::string>> stag {{tag::abx}};
     std::vector<std::string> dtag {tag::undef};
     std::vector<int> axis {1};
+    std::vector<std::vector<float>> scales {{1.f}};
+    std::vector<attr_t::zero_points_t> zero_points {attr_t::zero_points_t()};
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
 
@@ -57,27 +60,35 @@ struct settings_t {
 };
 
 struct prb_t {
-    prb_t(const std::vector<dims_t> &sdims, dnnl_data_type_t sdt,
-            dnnl_data_type_t ddt, const std::vector<std::string> &stag,
-            const std::string &dtag, int axis, const attr_t &attr)
+    prb_t(const std::vector<dims_t> &sdims,
+            const std::vector<dnnl_data_type_t> &sdt, dnnl_data_type_t ddt,
+            const std::vector<std::string> &stag, const std::string &dtag,
+            int axis, const std::vector<float> &scales, const attr_t &attr)
         : sdims(sdims)
         , sdt(sdt)
         , ddt(ddt)
         , stag(stag)
         , dtag(dtag)
         , axis(axis)
+        , scales(sdims.size())
         , attr(attr)
         , ndims((int)sdims[0].size()) {
+        // if there is a single scale then broadcast it
+        for (int i_input = 0; i_input < n_inputs(); i_input++)
+            this->scales[i_input]
+                    = ((int)scales.size() == 1) ? scales[0] : scales[i_input];
         generate_ddims();
     }
     ~prb_t() {}
 
     std::vector<dims_t> sdims;
     dims_t ddims;
-    dnnl_data_type_t sdt, ddt;
+    std::vector<dnnl_data_type_t> sdt;
+    dnnl_data_type_t ddt;
     std::vector<std::string> stag;
     std::string dtag;
     int axis;
+    std::vector<float> scales;
     attr_t attr;
     int ndims;
 
@@ -106,7 +117,6 @@ struct perf_report_t : public base_perf_report_t {
 
     void report(const prb_t *prb, const res_t *res, const char *prb_str) {
         p_ = prb;
-        sdt_ = {p_->sdt};
         for (size_t d = 0; d < p_->stag.size(); d++)
             stag_.push_back(normalize_tag(p_->stag[d], p_->ndims));
         dtag_ = normalize_tag(p_->dtag, p_->ndims);
@@ -118,14 +128,15 @@ struct perf_report_t : public base_perf_report_t {
     void dump_desc_csv(std::ostream &s) const override { s << p_->sdims; }
 
     const int *axis() const override { return &p_->axis; }
-    const std::vector<dnnl_data_type_t> *sdt() const override { return &sdt_; }
+    const std::vector<dnnl_data_type_t> *sdt() const override {
+        return &p_->sdt;
+    }
     const dnnl_data_type_t *ddt() const override { return &p_->ddt; }
     const std::vector<std::string> *stag() const override { return &stag_; }
     const std::string *dtag() const override { return &dtag_; }
 
 private:
     const prb_t *p_ = NULL;
-    std::vector<dnnl_data_type_t> sdt_;
     std::vector<std::string> stag_;
     std::string dtag_;
 };
@@ -19,8 +19,21 @@
 
 namespace concat {
 
+std::ostream &operator<<(std::ostream &s, const std::vector<float> &scales) {
+    bool has_single_scale = true;
+    for (size_t d = 0; d < scales.size() - 1; ++d)
+        has_single_scale = has_single_scale && scales[d] == scales[d + 1];
+
+    s << scales[0];
+    if (!has_single_scale)
+        for (size_t d = 1; d < scales.size(); ++d)
+            s << ":" << scales[d];
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
     using ::operator<<;
+    using concat::operator<<;
 
     dump_global_params(s);
     settings_t def;
@@ -36,6 +49,12 @@ std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
     if (canonical || prb.dtag != def.dtag[0]) s << "--dtag=" << prb.dtag << " ";
     if (canonical || prb.axis != def.axis[0]) s << "--axis=" << prb.axis << " ";
 
+    bool has_default_scales = true;
+    for (const auto &i_scale : prb.scales)
+        has_default_scales = has_default_scales && i_scale == 1.f;
+    if (canonical || !has_default_scales)
+        s << "--scales=" << prb.scales << " ";
+
     s << prb.attr;
     s << prb.sdims;
 
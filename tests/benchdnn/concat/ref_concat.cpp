@@ -36,18 +36,22 @@ void compute_ref(
     get_sizes(prb, outer_size, inner_size, axis_size);
 
     float *dst_ptr = (float *)dst;
+    const float dst_zero_point = prb->attr.zero_points[DNNL_ARG_DST];
 
     dnnl::impl::parallel_nd(
             outer_size, inner_size, [&](int64_t ou, int64_t in) {
                 int64_t off_dst = ou * axis_size * inner_size;
                 for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
                     const float *src_ptr = (const float *)src[i_input];
+                    const float scale = prb->scales[i_input];
                     int64_t i_axis_size = prb->sdims[i_input][prb->axis];
                     int64_t off_src = ou * i_axis_size * inner_size;
 
                     for (int64_t as = 0; as < i_axis_size; ++as) {
                         int64_t idx = as * inner_size + in;
-                        dst_ptr[off_dst + idx] = src_ptr[off_src + idx];
+                        dst_ptr[off_dst + idx]
+                                = scale * src_ptr[off_src + idx]
+                                + dst_zero_point;
                     }
                     off_dst += i_axis_size
                             * inner_size; // the next input start point
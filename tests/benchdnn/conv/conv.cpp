@@ -687,9 +687,36 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
             const bool sum_post_op_ok
                     = sum_idx == -1 || po.entry[sum_idx].sum.scale == 1.f;
 
-            if (!has_avx512_common || !shape_ok || (!has_avx512_bw && is_int8)
-                    || !bwd_is_syncable || (is_plain && !plain_ok)
-                    || !sum_post_op_ok) {
+            // AVX2 implementation supports forward propagation only, with
+            // nhwc or nChw8c activations, weights chosen by the library and
+            // padding up to 2, but has no restrictions on channels and sum
+            // scale.
+            static bool has_avx2 = isa >= dnnl_cpu_isa_avx2;
+            const bool pad_ok_avx2 = prb->pw <= 2 && prb->ph <= 2
+                    && prb->pw_r <= 2 && prb->ph_r <= 2 && prb->pw >= 0
+                    && prb->ph >= 0 && prb->pw_r >= 0 && prb->ph_r >= 0;
+            const bool shape_ok_avx2 = prb->ndims == 4 && prb->g == 1
+                    && prb->kh == 3 && prb->kw == 3 && prb->sh == 1
+                    && prb->sw == 1 && prb->dh == 0 && prb->dw == 0
+                    && pad_ok_avx2;
+            const auto blk8_tag = normalize_tag("aBx8b", prb->ndims);
+            const auto any_tag = normalize_tag(tag::any, prb->ndims);
+            const auto layout_ok_avx2 = [&](const std::string &t) {
+                return t == any_tag || t == blk8_tag
+                        || t == normalize_tag(tag::axb, prb->ndims);
+            };
+            const bool avx2_ok = has_avx2 && (prb->dir & FLAG_FWD)
+                    && shape_ok_avx2 && layout_ok_avx2(stag)
+                    && layout_ok_avx2(dtag)
+                    && normalize_tag(prb->wtag) == normalize_tag(tag::any)
+                    && IMPLICATION(stag != any_tag && dtag != any_tag,
+                            stag == dtag);
+
+            const bool avx512_ok = has_avx512_common && shape_ok
+                    && IMPLICATION(is_int8, has_avx512_bw) && bwd_is_syncable
+                    && IMPLICATION(is_plain, plain_ok) && sum_post_op_ok;
+
+            if (!avx512_ok && !avx2_ok) {
                 res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
                 return;
             }
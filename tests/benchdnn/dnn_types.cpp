@@ -18,6 +18,7 @@
 #include <cctype>
 #include <cmath>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
@@ -296,6 +297,7 @@ static po_table_entry_t kind_table[] = {
         // sum
         {pk_t::SUM, "sum", dnnl_alg_kind_undef},
         // depthwise convolution
+        {pk_t::DW, "dw", dnnl_convolution_auto},
         {pk_t::DW_K3S1P1, "dw_k3s1p1", dnnl_convolution_auto},
         {pk_t::DW_K3S2P1, "dw_k3s2p1", dnnl_convolution_auto},
         // eltwise
@@ -413,7 +415,10 @@ int attr_t::post_ops_t::from_str(const std::string &s) {
         if (kind == KIND_TOTAL) return FAIL;
 
         entry.emplace_back(kind);
-        if (subs_pos == std::string::npos) continue;
+        if (subs_pos == std::string::npos) {
+            if (kind == DW) return FAIL; // `DW` requires `kKsSpP` argument
+            continue;
+        }
         if (subs_pos >= subs.size()) return FAIL; // to catch dangling ':'
 
         auto &e = entry.back();
@@ -424,6 +429,22 @@ int attr_t::post_ops_t::from_str(const std::string &s) {
 
             e.sum.dt = str2dt(get_substr(subs, subs_pos).c_str());
         } else if (e.is_convolution_kind()) {
+            if (kind == DW) {
+                // `DW` has the kernel, stride and padding mandatory as a
+                // first argument in `kKsSpP` form.
+                const auto ksp_str = get_substr(subs, subs_pos);
+                int k = 0, st = 0, p = 0;
+                char tail = 0;
+                if (sscanf(ksp_str.c_str(), "k%ds%dp%d%c", &k, &st, &p, &tail)
+                                != 3
+                        || k <= 0 || st <= 0 || p < 0 || p >= k)
+                    return FAIL;
+                e.convolution.kernel = k;
+                e.convolution.stride = st;
+                e.convolution.padding = p;
+                if (subs_pos == std::string::npos) continue;
+                if (subs_pos >= subs.size()) return FAIL; // dangling ':'
+            }
             e.convolution.dst_dt = str2dt(get_substr(subs, subs_pos).c_str());
             if (subs_pos == std::string::npos) continue;
             if (subs_pos >= subs.size()) return FAIL; // to catch dangling ':'
@@ -473,7 +494,7 @@ bool attr_t::post_ops_t::entry_t::is_sum_kind() const {
     return kind == SUM;
 }
 bool attr_t::post_ops_t::entry_t::is_convolution_kind() const {
-    return kind == DW_K3S1P1 || kind == DW_K3S2P1;
+    return kind == DW || kind == DW_K3S1P1 || kind == DW_K3S2P1;
 }
 bool attr_t::post_ops_t::entry_t::is_eltwise_kind() const {
     return kind > ELTWISE_START && kind < ELTWISE_END;
@@ -622,6 +643,9 @@ std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops) {
                 s << ":" << e.sum.scale;
             if (e.sum.dt != dnnl_data_type_undef) s << ":" << e.sum.dt;
         } else if (e.is_convolution_kind()) {
+            if (e.kind == pk_t::DW)
+                s << ":k" << e.convolution.kernel << "s"
+                  << e.convolution.stride << "p" << e.convolution.padding;
             if (e.convolution.dst_dt != dnnl_f32)
                 s << ":" << e.convolution.dst_dt;
             const auto &co = e.convolution.oscale;
@@ -832,11 +856,10 @@ dnnl_primitive_attr_t create_dnnl_attr(
                 const auto count = scales ? os_args.get_count(policy) : 0;
                 const auto mask = os_args.get_mask(policy);
 
-                const auto dnnl_post_ops_append_dw = e.convolution.stride == 1
-                        ? dnnl_post_ops_append_dw_k3s1p1
-                        : dnnl_post_ops_append_dw_k3s2p1;
                 DNN_SAFE_V(dnnl_post_ops_append_dw(ops, wei_dt, bia_dt,
-                        e.convolution.dst_dt, count, mask, scales));
+                        e.convolution.dst_dt, e.convolution.kernel,
+                        e.convolution.stride, e.convolution.padding, count,
+                        mask, scales));
             } else if (e.is_eltwise_kind()) {
                 DNN_SAFE_V(dnnl_post_ops_append_eltwise(ops, e.eltwise.scale,
                         e.eltwise.alg, e.eltwise.alpha, e.eltwise.beta));
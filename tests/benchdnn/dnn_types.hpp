@@ -199,6 +199,7 @@ struct attr_t {
             // sum
             SUM,
             // depthwise convolution
+            DW,
             DW_K3S1P1,
             DW_K3S2P1,
             // eltwise
@@ -258,7 +259,9 @@ struct attr_t {
                     eltwise.beta = 0.f;
                     eltwise.scale = 1.f;
                 } else if (is_convolution_kind()) {
-                    convolution.stride = kind == DW_K3S1P1 ? 1 : 2;
+                    convolution.kernel = 3;
+                    convolution.stride = kind == DW_K3S2P1 ? 2 : 1;
+                    convolution.padding = 1;
                     convolution.dst_dt = dnnl_f32;
                     convolution.oscale = scale_t();
                 } else if (is_binary_kind()) {
@@ -279,7 +282,9 @@ struct attr_t {
                     float alpha, beta, scale;
                 } eltwise;
                 struct {
+                    int kernel;
                     int stride;
+                    int padding;
                     dnnl_data_type_t dst_dt;
                     scale_t oscale;
                 } convolution;
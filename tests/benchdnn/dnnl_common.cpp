@@ -14,15 +14,25 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <algorithm> // for std::reverse and std::copy
+#include <algorithm> // for std::reverse, std::copy and std::sort
+#include <atomic> // for std::atomic
 #include <cctype> // for std::isdigit
 #include <functional> // for std::bind and std::placeholders
+#include <memory> // for std::unique_ptr
 #include <string> // for std::string
+#include <thread> // for std::thread
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -35,6 +45,12 @@
 
 #include "cpu/platform.hpp"
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include <omp.h>
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+#include "tbb/task_arena.h"
+#endif
+
 float round_to_nearest_representable(dnnl_data_type_t dt, float value) {
     switch (dt) {
         case dnnl_f32: break;
@@ -143,24 +159,185 @@ dnnl_engine_kind_t get_engine_kind(const dnnl_engine_t &engine) {
     return engine_kind;
 }
 
+// Returns the list of logical CPUs the process is allowed to run on. Empty
+// list means the affinity is unknown and is not managed by the driver.
+static const std::vector<int> &get_process_cpus() {
+    static const std::vector<int> cpus = []() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+#endif
+        return cpus;
+    }();
+    return cpus;
+}
+
+static int get_max_threads() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Save the value before the driver changes it for the first time.
+    static const int max_threads = omp_get_max_threads();
+    return max_threads;
+#else
+    const int ncpus = (int)get_process_cpus().size();
+    return ncpus ? ncpus : (int)std::thread::hardware_concurrency();
+#endif
+}
+
+static int get_threads_per_instance() {
+    if (threads_per_instance) return threads_per_instance;
+    return MAX2(1, get_max_threads() / n_instances);
+}
+
+void init_instances_settings() {
+    const bool is_multi_instance = n_instances > 1 || threads_per_instance > 0;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Primitive descriptors are created in the main thread and CPU
+    // implementations pick their work partitioning based on the number of
+    // threads available at that point. Make it match the instance setting.
+    omp_set_num_threads(
+            is_multi_instance ? get_threads_per_instance() : get_max_threads());
+#else
+    if (is_multi_instance && threads_per_instance > 0) {
+        BENCHDNN_PRINT(2, "%s\n",
+                "WARNING: threads per instance are not applied to primitive "
+                "creation with the current threading runtime.");
+    }
+#endif
+}
+
+// Restricts the calling thread to the CPUs assigned to the instance. Threads
+// spawned by the threading runtime later inherit the mask.
+static void bind_instance_to_cpus(int instance, int nthr) {
+#if defined(__linux__)
+    const auto &cpus = get_process_cpus();
+    if (cpus.empty()) return;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int i = 0; i < nthr; ++i) {
+        const size_t idx = ((size_t)instance * nthr + i) % cpus.size();
+        CPU_SET(cpus[idx], &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+static size_t get_llc_size() {
+    size_t llc_size = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    const long l3_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3_size > 0) llc_size = (size_t)l3_size;
+#endif
+    // Some systems do not report cache sizes. Assume a reasonably big LLC
+    // since underestimating it leaves the data warm.
+    const size_t default_llc_size = 64 * 1024 * 1024;
+    return llc_size ? llc_size : default_llc_size;
+}
+
+// The number of copies of execution arguments used in cold cache mode. The
+// copies are iterated in a round-robin fashion and occupy at least twice the
+// LLC, so by the time a copy is reused its data was evicted from the caches.
+static int get_cold_cache_copies(const args_t &args) {
+    size_t args_size = 0;
+    for (int i = 0; i < args.size(); ++i)
+        args_size += args.dnn_mem(i).size();
+    if (args_size == 0) return 1;
+
+    const int64_t max_copies = 1024;
+    const int64_t n_copies = div_up(2 * get_llc_size(), args_size);
+    return (int)MAX2(2, MIN2(max_copies, n_copies));
+}
+
+// A set of memory objects holding copies of the execution arguments. Memory
+// objects used by several arguments (e.g. in-place) stay shared in a copy.
+struct args_copy_t {
+    args_copy_t(const args_t &args) {
+        std::vector<const dnn_mem_t *> origins;
+        mems_.reserve(args.size());
+        dnnl_args_.resize(args.size());
+        for (int i = 0; i < args.size(); ++i) {
+            const dnn_mem_t &mem = args.dnn_mem(i);
+            dnnl_args_[i].arg = args.arg(i);
+            // Empty memory objects hold no data and are passed as is
+            if (mem.size() == 0) {
+                dnnl_args_[i].memory = mem.m_;
+                continue;
+            }
+            const auto it = std::find(origins.begin(), origins.end(), &mem);
+            const size_t idx = it - origins.begin();
+            if (it == origins.end()) {
+                origins.push_back(&mem);
+                mems_.emplace_back(mem.md_, mem.engine());
+                memcpy((void *)mems_.back(), (void *)mem, mem.size());
+            }
+            dnnl_args_[i].memory = mems_[idx].m_;
+        }
+        // Unmap before passing the memory to execute
+        for (auto &mem : mems_)
+            mem.unmap();
+    }
+
+    ~args_copy_t() {
+        // dnn_mem_t expects the memory to be mapped at destruction
+        for (auto &mem : mems_)
+            mem.map();
+    }
+
+    const std::vector<dnnl_exec_arg_t> &dnnl_args() const { return dnnl_args_; }
+
+private:
+    std::vector<dnn_mem_t> mems_;
+    std::vector<dnnl_exec_arg_t> dnnl_args_;
+
+    BENCHDNN_DISALLOW_COPY_AND_ASSIGN(args_copy_t);
+};
+
+typedef std::vector<std::unique_ptr<args_copy_t>> args_copies_t;
+
+static void init_args_copies(
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args_sets,
+        args_copies_t &copies, const args_t &args, int n_copies) {
+    for (int i = 0; i < n_copies; ++i) {
+        copies.emplace_back(new args_copy_t(args));
+        dnnl_args_sets.push_back(copies.back()->dnnl_args());
+    }
+}
+
 inline int measure_perf_individual(benchdnn_timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args_sets,
+        std::vector<double> *latencies = nullptr) {
+    const size_t n_sets = dnnl_args_sets.size();
     t.reset();
-    while (true) {
-        DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+    for (size_t i = 0;; i = (i + 1) % n_sets) {
+        const double prev_total_ms = t.total_ms();
+        DNN_SAFE(perf_func(stream, dnnl_args_sets[i]), WARN);
         t.stamp();
+        if (latencies) latencies->push_back(t.total_ms() - prev_total_ms);
         if (should_stop(t)) break;
     }
     return OK;
 }
 
 inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func,
+        std::vector<std::vector<dnnl_exec_arg_t>> &dnnl_args_sets) {
     const int max_batch_times = 10000;
+    const size_t n_sets = dnnl_args_sets.size();
+    size_t cur_set = 0;
+    auto next_args = [&]() -> const std::vector<dnnl_exec_arg_t> & {
+        const size_t idx = cur_set;
+        cur_set = (cur_set + 1) % n_sets;
+        return dnnl_args_sets[idx];
+    };
 
     // Warm-up run
     t.reset();
-    DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+    DNN_SAFE(perf_func(stream, next_args()), WARN);
     DNN_SAFE(dnnl_stream_wait(stream), WARN);
     t.stamp();
 
@@ -170,7 +347,7 @@ inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
 
     while (true) {
         for (int i = 0; i < cur_batch_times; i++) {
-            DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+            DNN_SAFE(perf_func(stream, next_args()), WARN);
         }
         DNN_SAFE(dnnl_stream_wait(stream), WARN);
         t.stamp(cur_batch_times);
@@ -192,20 +369,132 @@ inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
     return OK;
 }
 
+static double get_percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    return sorted[(size_t)(p * (sorted.size() - 1) + 0.5)];
+}
+
+// Runs `n_instances` instances of the problem concurrently. Each instance
+// owns a stream and a copy of the arguments and is bound to its own subset of
+// CPUs. The resulting timer accumulates iterations of all instances.
+static int measure_perf_multi_instance(benchdnn_timer_t &t,
+        perf_function_t &perf_func, const args_t &args) {
+    const int nthr = get_threads_per_instance();
+
+    std::vector<benchdnn_timer_t> timers(n_instances);
+    std::vector<std::vector<double>> latencies(n_instances);
+    std::vector<int> statuses(n_instances, OK);
+    std::atomic<int> n_ready(0);
+
+    // Copies are made in the main thread while the arguments are mapped.
+    std::vector<args_copies_t> copies(n_instances);
+    std::vector<std::vector<std::vector<dnnl_exec_arg_t>>> dnnl_args_sets(
+            n_instances);
+    const int n_copies = cold_cache ? get_cold_cache_copies(args) : 1;
+    for (int i = 0; i < n_instances; ++i)
+        init_args_copies(dnnl_args_sets[i], copies[i], args, n_copies);
+
+    auto instance_func = [&](int instance) {
+        bind_instance_to_cpus(instance, nthr);
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(nthr);
+#endif
+        stream_t stream(get_test_engine());
+        auto run = [&]() {
+            // Warm-up run outside of measurements
+            DNN_SAFE_V(perf_func(stream, dnnl_args_sets[instance][0]));
+            DNN_SAFE_V(dnnl_stream_wait(stream));
+            // Start measurements simultaneously
+            ++n_ready;
+            while (n_ready.load() < n_instances)
+                std::this_thread::yield();
+            statuses[instance] = measure_perf_individual(timers[instance],
+                    stream, perf_func, dnnl_args_sets[instance],
+                    &latencies[instance]);
+        };
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+        tbb::task_arena arena(nthr);
+        arena.execute(run);
+#else
+        run();
+#endif
+    };
+
+    std::vector<std::thread> instances;
+    for (int i = 0; i < n_instances; ++i)
+        instances.emplace_back(instance_func, i);
+    for (auto &instance : instances)
+        instance.join();
+
+    for (int i = 0; i < n_instances; ++i)
+        if (statuses[i] != OK) return statuses[i];
+
+    // Merge instance timers: min and max are taken over all iterations while
+    // the average is computed over iterations of all instances.
+    t = timers[0];
+    double max_total_ms = timers[0].total_ms();
+    for (int i = 1; i < n_instances; ++i) {
+        const auto &ti = timers[i];
+        t.times_ += ti.times_;
+        t.ms_[benchdnn_timer_t::avg] += ti.ms_[benchdnn_timer_t::avg];
+        t.ticks_[benchdnn_timer_t::avg] += ti.ticks_[benchdnn_timer_t::avg];
+        t.ms_[benchdnn_timer_t::min] = MIN2(
+                t.ms_[benchdnn_timer_t::min], ti.ms_[benchdnn_timer_t::min]);
+        t.ticks_[benchdnn_timer_t::min] = MIN2(t.ticks_[benchdnn_timer_t::min],
+                ti.ticks_[benchdnn_timer_t::min]);
+        t.ms_[benchdnn_timer_t::max] = MAX2(
+                t.ms_[benchdnn_timer_t::max], ti.ms_[benchdnn_timer_t::max]);
+        t.ticks_[benchdnn_timer_t::max] = MAX2(t.ticks_[benchdnn_timer_t::max],
+                ti.ticks_[benchdnn_timer_t::max]);
+        max_total_ms = MAX2(max_total_ms, ti.total_ms());
+    }
+
+    // Instances start simultaneously, so the aggregate throughput is the
+    // number of all iterations over the time of the slowest instance.
+    const double throughput = max_total_ms > 0 ? t.times() / max_total_ms * 1e3
+                                               : 0;
+    BENCHDNN_PRINT(0,
+            "instances: %d, threads per instance: %d, throughput: %g "
+            "iterations/s\n",
+            n_instances, nthr, throughput);
+    for (int i = 0; i < n_instances; ++i) {
+        auto &l = latencies[i];
+        std::sort(l.begin(), l.end());
+        BENCHDNN_PRINT(0,
+                "instance %d: iterations: %d, latency (ms): p50=%g p90=%g "
+                "p99=%g\n",
+                i, timers[i].times(), get_percentile(l, 0.5),
+                get_percentile(l, 0.9), get_percentile(l, 0.99));
+    }
+    return OK;
+}
+
 int measure_perf(
         benchdnn_timer_t &t, perf_function_t &perf_func, args_t &args) {
     int ret = OK;
     if (bench_mode & PERF) {
+        // Multiple instances are supported for CPU only
+        if (n_instances > 1 && is_cpu())
+            return measure_perf_multi_instance(t, perf_func, args);
+
+        // Copies for cold cache mode are made while the arguments are mapped
+        args_copies_t copies;
+        std::vector<std::vector<dnnl_exec_arg_t>> dnnl_args_sets;
+        if (cold_cache)
+            init_args_copies(dnnl_args_sets, copies, args,
+                    get_cold_cache_copies(args));
+
         stream_t stream(get_test_engine());
         std::vector<dnnl_exec_arg_t> dnnl_args;
         execute_unmap_args(args, dnnl_args);
+        if (dnnl_args_sets.empty()) dnnl_args_sets.push_back(dnnl_args);
 
         // For CPU: measure individual iterations
         // For GPU: measure iterations in batches to hide driver overhead
         if (is_cpu())
-            ret = measure_perf_individual(t, stream, perf_func, dnnl_args);
+            ret = measure_perf_individual(t, stream, perf_func, dnnl_args_sets);
         else
-            ret = measure_perf_aggregate(t, stream, perf_func, dnnl_args);
+            ret = measure_perf_aggregate(t, stream, perf_func, dnnl_args_sets);
 
         if (ret == OK) execute_map_args(args);
     }
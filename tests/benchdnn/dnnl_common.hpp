@@ -231,6 +231,7 @@ enum class sycl_memory_kind_ext_t {
 extern sycl_memory_kind_ext_t sycl_memory_kind;
 
 void init_isa_settings();
+void init_instances_settings();
 
 inline const char *query_impl_info(const_dnnl_primitive_desc_t pd) {
     const char *str;
@@ -273,6 +273,31 @@ static bool parse_fix_times_per_prb(
     return false;
 }
 
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    return parse_single_value_option(
+            cold_cache, false, str2bool, str, option_name);
+}
+
+static bool parse_instances(
+        const char *str, const std::string &option_name = "instances") {
+    if (!parse_single_value_option(n_instances, 1, atoi, str, option_name))
+        return false;
+    n_instances = MAX2(1, n_instances);
+    init_instances_settings();
+    return true;
+}
+
+static bool parse_threads_per_instance(const char *str,
+        const std::string &option_name = "threads-per-instance") {
+    if (!parse_single_value_option(
+                threads_per_instance, 0, atoi, str, option_name))
+        return false;
+    threads_per_instance = MAX2(0, threads_per_instance);
+    init_instances_settings();
+    return true;
+}
+
 static bool parse_verbose(
         const char *str, const std::string &option_name = "verbose") {
     const std::string pattern("-v"); // check short option first
@@ -373,12 +398,13 @@ bool parse_bench_settings(const char *str) {
     last_parsed_is_problem = false; // if start parsing, expect an option
 
     return parse_bench_mode(str) || parse_max_ms_per_prb(str)
-            || parse_fix_times_per_prb(str) || parse_verbose(str)
-            || parse_engine(str) || parse_fast_ref_gpu(str)
-            || parse_canonical(str) || parse_mem_check(str)
-            || parse_skip_impl(str) || parse_allow_enum_tags_only(str)
-            || parse_cpu_isa_hints(str) || parse_sycl_memory_kind(str)
-            || parse_test_start(str);
+            || parse_fix_times_per_prb(str) || parse_cold_cache(str)
+            || parse_instances(str) || parse_threads_per_instance(str)
+            || parse_verbose(str) || parse_engine(str)
+            || parse_fast_ref_gpu(str) || parse_canonical(str)
+            || parse_mem_check(str) || parse_skip_impl(str)
+            || parse_allow_enum_tags_only(str) || parse_cpu_isa_hints(str)
+            || parse_sycl_memory_kind(str) || parse_test_start(str);
 }
 
 void catch_unknown_options(const char *str) {
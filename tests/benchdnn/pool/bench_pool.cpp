@@ -34,9 +34,11 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_tag : s.tag)
     for_(const auto &i_alg : s.alg)
     for_(const auto &i_mb : s.mb)
+    for_(const auto &i_oscale : s.oscale)
     for_(const auto &i_post_ops : s.post_ops)
     for (const auto &i_scratchpad_mode : s.scratchpad_mode) {
         attr_t attr;
+        attr.insert(i_oscale);
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
 
@@ -75,6 +77,7 @@ int bench(int argc, char **argv) {
                 || parse_tag(s.tag, def.tag, argv[0])
                 || parse_alg(s.alg, def.alg, str2alg, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
+                || parse_attr_oscale(s.oscale, argv[0])
                 || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
@@ -143,6 +143,7 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
     }
 
     attr_args_t attr_args;
+    attr_args.prepare_output_scales(prb->attr, &prb->attr.oscale.scale, 1);
     attr_args.prepare_binary_post_op_mds(prb->attr, prb->ndims, dst_dims);
     auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args);
 
@@ -192,7 +193,11 @@ void check_known_skipped_case(const prb_t *prb, res_t *res) {
         }
     }
 
-    if (is_cpu() && prb->cfg[SRC].dt != prb->cfg[DST].dt) {
+    // Output scales are supported for forward propagation only, with a single
+    // value for the whole tensor.
+    if (!prb->attr.oscale.is_def()
+            && (prb->attr.oscale.policy != policy_t::COMMON
+                    || (prb->dir & FLAG_BWD))) {
         res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
         return;
     }
@@ -260,6 +265,9 @@ int doit(const prb_t *prb, res_t *res) {
     dnn_mem_t ws_fp(ws_md, test_engine);
     dnn_mem_t ws_dt(ws_md, test_engine);
     dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
+    dnn_mem_t scales;
+    float scale = prb->attr.oscale.scale;
+    maybe_prepare_runtime_scales(scales, prb->attr, 1, &scale);
     std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
     std::vector<int> binary_po_args;
     SAFE(binary::setup_binary_po(
@@ -275,6 +283,7 @@ int doit(const prb_t *prb, res_t *res) {
     args.set(DNNL_ARG_DST, dst_dt);
     args.set(DNNL_ARG_WORKSPACE, ws_dt);
     args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+    args.set(DNNL_ARG_ATTR_OUTPUT_SCALES, scales);
     args.set(binary_po_args, binary_po_dt);
 
     SAFE(execute_and_wait(pp, args), WARN);
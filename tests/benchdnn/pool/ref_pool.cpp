@@ -68,6 +68,9 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
             res = avg_value / get_num_summands(prb, od, oh, ow);
         }
 
+        float scale = prb->attr.oscale.scale;
+        maybe_oscale(prb->attr, res, &scale, 0);
+
         std::vector<float> v_binary_vals;
         v_binary_vals.reserve(v_bin_po_mask.size());
         for (size_t d = 0; d < v_bin_po_mask.size(); ++d) {
@@ -38,7 +38,9 @@ float weight(const int64_t y, const int64_t y_max, const int64_t x_max) {
     return fabs(linear_map(y, y_max, x_max) - left(y, y_max, x_max));
 }
 
-void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst) {
+void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src,
+        const std::vector<dnn_mem_t> &binary_po, dnn_mem_t &dst) {
+    std::vector<int> v_bin_po_mask = prb->attr.post_ops.get_binary_po_masks();
     int64_t MB = prb->mb;
     int64_t IC = prb->ic;
     int64_t ID = prb->id;
@@ -53,8 +55,7 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst) {
         const int64_t id = near(od, OD, ID);
         const int64_t ih = near(oh, OH, IH);
         const int64_t iw = near(ow, OW, IW);
-        const auto dst_off = dst_off_f(prb, mb, ic, od, oh, ow);
-        dst.set_elem(dst_off, src.get_elem(src_off_f(prb, mb, ic, id, ih, iw)));
+        return src.get_elem(src_off_f(prb, mb, ic, id, ih, iw));
     };
     auto ker_linear = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh,
                               int64_t ow) {
@@ -77,19 +78,29 @@ void compute_ref_fwd(const prb_t *prb, const dnn_mem_t &src, dnn_mem_t &dst) {
         for (int i = 0; i < 2; i++)
             ch[i] = cd[0][i] * wh[0] + cd[1][i] * wh[1];
 
-        float cw = ch[0] * ww[0] + ch[1] * ww[1];
-
-        const auto dst_off = dst_off_f(prb, mb, ic, od, oh, ow);
-        dst.set_elem(dst_off, cw);
+        return ch[0] * ww[0] + ch[1] * ww[1];
     };
 
     dnnl::impl::parallel_nd(MB, IC, OD, OH, OW,
             [&](int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
-                if (prb->alg == nearest) {
-                    ker_nearest(mb, ic, od, oh, ow);
-                } else {
-                    ker_linear(mb, ic, od, oh, ow);
+                float res = prb->alg == nearest
+                        ? ker_nearest(mb, ic, od, oh, ow)
+                        : ker_linear(mb, ic, od, oh, ow);
+
+                float scale = prb->attr.oscale.scale;
+                maybe_oscale(prb->attr, res, &scale, 0);
+
+                const auto dst_off = dst_off_f(prb, mb, ic, od, oh, ow);
+                std::vector<float> v_binary_vals;
+                v_binary_vals.reserve(v_bin_po_mask.size());
+                for (size_t d = 0; d < v_bin_po_mask.size(); ++d) {
+                    auto bin_po_offset
+                            = dst.get_scale_idx(dst_off, v_bin_po_mask[d]);
+                    float binary_val = binary_po[d].get_elem(bin_po_offset);
+                    v_binary_vals.push_back(binary_val);
                 }
+                maybe_post_ops(prb->attr, res, 0.f, v_binary_vals);
+                dst.set_elem(dst_off, res);
             });
 }
 
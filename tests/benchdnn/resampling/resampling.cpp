@@ -27,6 +27,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "resampling/resampling.hpp"
 
 namespace resampling {
@@ -34,15 +35,17 @@ namespace resampling {
 int fill_dat(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
         dnn_mem_t &mem_fp, res_t *res) {
     const auto nelems = mem_fp.nelems();
-    const auto dt = prb->dt;
+    const auto dt = mem_dt.dt();
     const int range = 16;
     const int f_min = 0;
 
     dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
         const float gen = ((97 * i) - 19 * kind + 101) % (range + 1);
-        const float value = (dt == dnnl_f32)
-                ? (f_min + gen) * (1.0f + 4.0f / range)
-                : (f_min + gen) / range;
+        float value = (f_min + gen) / range;
+        if (dt == dnnl_f32)
+            value = (f_min + gen) * (1.0f + 4.0f / range);
+        else if (is_integral_dt(dt))
+            value = f_min + gen - (dt == dnnl_s8 ? range / 2 : 0);
         mem_fp.set_elem(i, round_to_nearest_representable(dt, value));
     });
 
@@ -83,9 +86,9 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
     std::string src_tag = (prb->dir & FLAG_FWD) ? prb->tag : tag::any;
     std::string dst_tag = (prb->dir & FLAG_BWD) ? prb->tag : tag::any;
 
-    SAFE(init_md(&src_d, prb->ndims, src_dims, prb->dt, src_tag), CRIT);
+    SAFE(init_md(&src_d, prb->ndims, src_dims, prb->sdt, src_tag), CRIT);
 
-    SAFE(init_md(&dst_d, prb->ndims, dst_dims, prb->dt, dst_tag), CRIT);
+    SAFE(init_md(&dst_d, prb->ndims, dst_dims, prb->ddt, dst_tag), CRIT);
 
     dnnl_alg_kind_t alg = alg2alg_kind(prb->alg);
     dnnl_resampling_desc_t pd;
@@ -105,9 +108,9 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
     dnnl_primitive_desc_t _hint = nullptr;
     if (prb->dir & FLAG_BWD) {
         dnnl_memory_desc_t fwd_src_d, fwd_dst_d;
-        SAFE(init_md(&fwd_src_d, prb->ndims, src_dims, prb->dt, prb->tag),
+        SAFE(init_md(&fwd_src_d, prb->ndims, src_dims, prb->sdt, prb->tag),
                 CRIT);
-        SAFE(init_md(&fwd_dst_d, prb->ndims, dst_dims, prb->dt, tag::any),
+        SAFE(init_md(&fwd_dst_d, prb->ndims, dst_dims, prb->ddt, tag::any),
                 CRIT);
 
         dnnl_resampling_desc_t rd_fwd;
@@ -122,7 +125,10 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
         SAFE(init_fwd_status, WARN);
     }
 
-    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args_t());
+    attr_args_t attr_args;
+    attr_args.prepare_output_scales(prb->attr, &prb->attr.oscale.scale, 1);
+    attr_args.prepare_binary_post_op_mds(prb->attr, prb->ndims, dst_dims);
+    auto dnnl_attr = create_dnnl_attr(prb->attr, attr_args);
 
     dnnl_status_t init_status
             = dnnl_primitive_desc_create(&rpd, &pd, dnnl_attr, engine, _hint);
@@ -149,11 +155,27 @@ static int init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void check_known_skipped_case(const prb_t *prb, res_t *res) {
-    check_known_skipped_case_common({prb->dt}, prb->dir, res);
+    check_known_skipped_case_common({prb->sdt, prb->ddt}, prb->dir, res);
     if (res->state == SKIPPED) return;
 
+    // Different data types and attributes are supported for forward
+    // propagation only, output scales are supported with a single value for
+    // the whole tensor.
+    if ((prb->dir & FLAG_BWD)
+            && (prb->sdt != prb->ddt || !prb->attr.oscale.is_def()
+                    || !prb->attr.post_ops.is_def())) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+    if (!prb->attr.oscale.is_def()
+            && prb->attr.oscale.policy != policy_t::COMMON) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_nvidia_gpu()) {
-        if (prb->ndims == 5 || prb->alg == nearest) {
+        if (prb->ndims == 5 || prb->alg == nearest || prb->sdt != prb->ddt
+                || !prb->attr.is_def()) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
@@ -202,6 +224,16 @@ int doit(const prb_t *prb, res_t *res) {
 
     dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
 
+    dnn_mem_t scales;
+    float scale = prb->attr.oscale.scale;
+    maybe_prepare_runtime_scales(scales, prb->attr, 1, &scale);
+
+    std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+    std::vector<int> binary_po_args;
+    SAFE(binary::setup_binary_po(
+                 const_pd, binary_po_args, binary_po_dt, binary_po_fp),
+            WARN);
+
     args_t args;
 
     if (prb->dir & FLAG_FWD) {
@@ -209,19 +241,37 @@ int doit(const prb_t *prb, res_t *res) {
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        args.set(DNNL_ARG_ATTR_OUTPUT_SCALES, scales);
+        args.set(binary_po_args, binary_po_dt);
 
         SAFE(execute_and_wait(rp, args), WARN);
 
         if (bench_mode & CORR) {
-            compute_ref_fwd(prb, src_fp, dst_fp);
-            float trh = prb->alg == nearest ? 0.f : 3 * epsilon_dt(prb->dt);
+            compute_ref_fwd(prb, src_fp, binary_po_fp, dst_fp);
+            float trh = prb->alg == nearest ? 0.f : 3 * epsilon_dt(prb->ddt);
             if (is_nvidia_gpu()) {
                 // cuDNN precision is different from ref one due to different
                 // computation algorithm used for resampling.
-                trh = prb->dt == dnnl_f16 ? 4e-2 : 2e-5;
+                trh = prb->ddt == dnnl_f16 ? 4e-2 : 2e-5;
             }
             compare::compare_t cmp;
             cmp.set_threshold(trh);
+            const bool has_binary_po
+                    = prb->attr.post_ops.binary_index() != -1;
+            const auto resampling_add_check
+                    = [&](int64_t i, float got, float diff) {
+                          if (prb->alg != linear) return false;
+                          // Interpolated values close to the middle between
+                          // two integers may be rounded differently.
+                          if (is_integral_dt(prb->ddt)) return diff <= 1.f;
+                          // Binary post-ops or source values of different
+                          // signs may cancel out most of the interpolated
+                          // value, making its rounding error relatively big.
+                          // Check the absolute error instead.
+                          return (has_binary_po || prb->sdt == dnnl_s8)
+                                  && diff <= 16 * epsilon_dt(dnnl_f32);
+                      };
+            cmp.set_driver_check_function(resampling_add_check);
             // No sense to test zero trust for upsampling since it produces
             // valid zeros.
             // TODO: validate this once again.
@@ -238,7 +288,7 @@ int doit(const prb_t *prb, res_t *res) {
 
         if (bench_mode & CORR) {
             compute_ref_bwd(prb, src_fp, dst_fp);
-            float trh = prb->alg == nearest ? 0.f : 6 * epsilon_dt(prb->dt);
+            float trh = prb->alg == nearest ? 0.f : 6 * epsilon_dt(prb->sdt);
             // cuDNN precision is different from ref one due to different
             // computation algorithm used for resampling.
             if (is_nvidia_gpu()) trh = 2e-5;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -151,7 +151,6 @@ void append_convolution(attr_t::post_ops_t &po, pk_t akind,
         dnnl_data_type_t adst_dt = dnnl_f32,
         policy_t apolicy = policy_t::COMMON, float ascale = 1.f) {
     attr_t::post_ops_t::entry_t e(akind);
-    e.convolution.stride = e.kind == pk_t::DW_K3S1P1 ? 1 : 2;
     e.convolution.dst_dt = adst_dt;
     e.convolution.oscale = attr_t::scale_t(apolicy, ascale);
     po.entry.push_back(e);
@@ -198,6 +197,14 @@ static int check_post_ops2str() {
             "'sum;relu;sum:2:s8;linear:5:10:2;dw_k3s1p1;dw_k3s2p1:s32:per_oc:"
             "2'");
 
+    attr_t::post_ops_t po_dw;
+    append_convolution(po_dw, pk_t::DW, dnnl_u8, policy_t::COMMON, 0.5f);
+    auto &e = po_dw.entry.back();
+    e.convolution.kernel = 5;
+    e.convolution.stride = 2;
+    e.convolution.padding = 2;
+    CHECK_PRINT_EQ(po_dw, "'dw:k5s2p2:u8:common:0.5'");
+
     return OK;
 }
 
@@ -235,6 +242,22 @@ static int check_str2post_ops() {
     ops.from_str("'sum:2;relu;sum:3;relu;'");
     CHECK_EQ(quick(4), OK);
 
+    CHECK_EQ(ops.from_str("'dw:k5s1p2:s8'"), OK);
+    CHECK_EQ(ops.len(), 1);
+    CHECK_EQ(ops.entry[0].kind, attr_t::post_ops_t::DW);
+    CHECK_EQ(ops.entry[0].convolution.kernel, 5);
+    CHECK_EQ(ops.entry[0].convolution.stride, 1);
+    CHECK_EQ(ops.entry[0].convolution.padding, 2);
+    CHECK_EQ(ops.entry[0].convolution.dst_dt, dnnl_s8);
+
+    ops.from_str("'dw_k3s2p1'");
+    CHECK_EQ(ops.entry[0].convolution.kernel, 3);
+    CHECK_EQ(ops.entry[0].convolution.stride, 2);
+    CHECK_EQ(ops.entry[0].convolution.padding, 1);
+
+    CHECK_EQ(ops.from_str("'dw'"), FAIL);
+    CHECK_EQ(ops.from_str("'dw:k3s1p3'"), FAIL);
+
     return OK;
 }
 
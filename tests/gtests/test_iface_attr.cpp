@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -401,6 +401,40 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusionPostop) {
     ASSERT_EQ(dst_dt, memory::data_type::f32);
     ASSERT_EQ(scales_mask, 1 << 1);
     ASSERT_EQ(scales_in, scales_out);
+
+    memory::dim kernel, stride, padding;
+    scales_in = {2};
+    ops.append_dw(memory::data_type::f32, memory::data_type::undef,
+            memory::data_type::f32, 5, 2, 2, 0, scales_in);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().kind(2), primitive::kind::convolution);
+    attr.get_post_ops().get_params_dw(2, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+    ASSERT_EQ(wei_dt, memory::data_type::f32);
+    ASSERT_EQ(bias_dt, memory::data_type::undef);
+    ASSERT_EQ(dst_dt, memory::data_type::f32);
+    ASSERT_EQ(kernel, 5);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 2);
+    ASSERT_EQ(scales_mask, 0);
+    ASSERT_EQ(scales_in, scales_out);
+
+    // The k3s1p1 getter reports the generic post-op as a mismatch, while the
+    // generic getter covers k3s1p1 and k3s2p1 entries as well.
+    EXPECT_ANY_THROW(attr.get_post_ops().get_params_dw_k3s1p1(
+            2, wei_dt, bias_dt, dst_dt, scales_mask, scales_out));
+    attr.get_post_ops().get_params_dw(1, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+    ASSERT_EQ(kernel, 3);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 1);
+
+    // Padding must be less than the kernel size.
+    EXPECT_ANY_THROW(ops.append_dw(memory::data_type::f32,
+            memory::data_type::f32, memory::data_type::f32, 3, 1, 3, 0, {}));
+    EXPECT_ANY_THROW(ops.append_dw(memory::data_type::f32,
+            memory::data_type::f32, memory::data_type::f32, 0, 1, 0, 0, {}));
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
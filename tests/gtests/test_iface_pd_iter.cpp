@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_types.h"
 
+#include "src/common/dispatch_cache.hpp"
+
 namespace dnnl {
 
 const dnnl_status_t ok = dnnl_success;
@@ -88,4 +90,44 @@ TEST(pd_next_impl, TestEltwiseImpl) {
     }
 }
 
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+TEST(pd_dispatch_cache_test, TestImplOrderIsPreserved) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    auto eng = get_test_engine();
+    // A shape no other test uses, so that the first creation is a miss
+    memory::desc src_md({3, 24, 13, 11}, dt::f32, tag::any);
+    memory::desc wei_md({40, 24, 3, 3}, dt::f32, tag::any);
+    memory::desc dst_md({3, 40, 13, 11}, dt::f32, tag::any);
+    auto cd = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    auto get_impls = [&]() {
+        std::vector<std::string> impls;
+        auto pd = convolution_forward::primitive_desc(cd, eng);
+        do {
+            impls.emplace_back(pd.impl_info_str());
+        } while (pd.next_impl());
+        return impls;
+    };
+
+    dnnl_dim_t hits0 = 0, misses0 = 0, hits1 = 0, misses1 = 0, hits2 = 0,
+               misses2 = 0;
+    ASSERT_EQ(impl::get_dispatch_cache_stats(nullptr, &hits0, &misses0),
+            impl::status::success);
+    const auto impls_miss = get_impls();
+    impl::get_dispatch_cache_stats(nullptr, &hits1, &misses1);
+    const auto impls_hit = get_impls();
+    impl::get_dispatch_cache_stats(nullptr, &hits2, &misses2);
+
+    ASSERT_GT(misses1, misses0);
+    ASSERT_GT(hits2, hits1);
+    ASSERT_EQ(misses2, misses1);
+    // Skipping the failing implementations must not change the result
+    ASSERT_EQ(impls_miss, impls_hit);
+}
+#endif
+
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -113,8 +113,10 @@ TEST_F(runtime_attr_test_t, TestConcat) {
 
     for (auto arg :
             {DNNL_ARG_MULTIPLE_SRC, DNNL_ARG_MULTIPLE_SRC + 1, DNNL_ARG_DST}) {
-        CHECK_UNIMPL(concat::primitive_desc(
-                1, {md, md}, eng, gen_attr_with_zp(false, arg)));
+        // a common dst zero point is supported by some implementations
+        if (arg != DNNL_ARG_DST)
+            CHECK_UNIMPL(concat::primitive_desc(
+                    1, {md, md}, eng, gen_attr_with_zp(false, arg)));
         CHECK_UNIMPL(concat::primitive_desc(
                 1, {md, md}, eng, gen_attr_with_zp(true, arg)));
     }
@@ -309,10 +311,17 @@ TEST_F(runtime_attr_test_t, TestPool) {
             algorithm::pooling_max, src_md, dst_md, {2, 2}, {2, 2}, {0, 0},
             {0, 0});
     CHECK_OK(pooling_forward::primitive_desc(op_d, eng));
-    CHECK_UNIMPL(pooling_forward::primitive_desc(
-            op_d, gen_attr_with_oscale(false), eng));
-    CHECK_UNIMPL(pooling_forward::primitive_desc(
-            op_d, gen_attr_with_oscale(true), eng));
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        CHECK_OK(pooling_forward::primitive_desc(
+                op_d, gen_attr_with_oscale(false), eng));
+        CHECK_OK(pooling_forward::primitive_desc(
+                op_d, gen_attr_with_oscale(true), eng));
+    } else {
+        CHECK_UNIMPL(pooling_forward::primitive_desc(
+                op_d, gen_attr_with_oscale(false), eng));
+        CHECK_UNIMPL(pooling_forward::primitive_desc(
+                op_d, gen_attr_with_oscale(true), eng));
+    }
 
     for (auto arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
         CHECK_UNIMPL(pooling_forward::primitive_desc(
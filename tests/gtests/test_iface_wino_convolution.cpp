@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020 Intel Corporation
+* Copyright 2020-2021 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -38,6 +38,7 @@ protected:
         data_type wei_dt;
         bool wino_supported = false;
         bool backward_supported = false;
+        bool large_padding_supported = false;
     } input_f32, input_f16, input_int8;
 
     void SetUp() override {
@@ -54,13 +55,16 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
 #if DNNL_X64
         static const auto isa = get_effective_cpu_isa();
-        input_f32.wino_supported = is_gpu
-                || (is_cpu && isa >= cpu_isa::avx512_mic
-                        && isa != cpu_isa::avx2_vnni);
+        // Forward propagation is supported starting with AVX2, including
+        // padding up to 2.
+        const bool has_avx2_wino = is_cpu && isa >= cpu_isa::avx2;
+        input_f32.wino_supported = is_gpu || has_avx2_wino;
         input_f16.wino_supported = is_gpu;
-        input_int8.wino_supported = is_cpu && isa >= cpu_isa::avx512_core
-                && isa != cpu_isa::avx2_vnni;
-        input_f32.backward_supported = is_cpu && impl::dnnl_thr_syncable();
+        input_int8.wino_supported = has_avx2_wino;
+        input_f32.backward_supported = is_cpu && isa >= cpu_isa::avx512_mic
+                && isa != cpu_isa::avx2_vnni && impl::dnnl_thr_syncable();
+        input_f32.large_padding_supported = has_avx2_wino;
+        input_int8.large_padding_supported = has_avx2_wino;
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
         input_f32.wino_supported = is_cpu;
 #endif
@@ -117,7 +121,8 @@ TEST_F(wino_conv_test_t, TestLargePadding) {
                 algorithm::convolution_winograd, src_md, wei_md, dst_md, {1, 1},
                 {2, 2}, {2, 2});
 
-        bool large_pad_is_supported = is_nvidia_gpu(eng) ? true : false;
+        bool large_pad_is_supported
+                = is_nvidia_gpu(eng) || input.large_padding_supported;
         if (input.wino_supported && large_pad_is_supported) {
             EXPECT_NO_THROW(
                     convolution_forward::primitive_desc(fwd_op_desc, eng));